@@ -0,0 +1,367 @@
+//-----------------------------------------------------------------------------
+//   File: AsyncQueue.h
+//-----------------------------------------------------------------------------
+
+//-------------------------------------------------------------------------------------------
+//    Class:			CAsyncQueue
+//
+//    File:             AsyncQueue.h
+//
+//    Title:            CAsyncQueue Class
+//
+//    Description:		This file contains the class definition for
+//						CAsyncQueue, a CQueue that coroutines pop with
+//						co_await, and the executors that resume them.
+//						Needs C++20.
+//
+//    Programmer:		Reinaldo Daniswara
+//
+//    Date:             10/17/2026
+//
+//    Version:          1.0
+//
+//   Environment:		Intel COre i7
+//						Software: MS Windows 10 for execution;
+//						Compiles under Microsoft Visual Studio 2015
+//
+//	  class executor:
+//
+//	  Somewhere to resume coroutines. post(h) must resume h later, on some
+//	  thread of the executor's choosing, and never inside post itself.
+//
+//		void post(coroutine_handle<> h) -- pure virtual, queue h to resume
+//		schedule_awaiter schedule() -- co_await it to continue on the executor
+//
+//	  class manual_executor : executor:
+//
+//	  Single threaded: posted coroutines wait in a CQueue until the owner
+//	  calls run() or run_one(). Only that thread may post to it.
+//
+//		void post(coroutine_handle<> h)
+//		bool run_one() -- resumes the oldest posted coroutine, false if none
+//		size_t run() -- resumes until nothing is posted, returns how many
+//		unsigned getSize() const -- coroutines waiting to run
+//
+//	  class pool_executor : executor:
+//
+//	  Resumes coroutines as tasks on a thread_pool, so posting from any
+//	  thread is fine. The pool needs at least one worker.
+//
+//		pool_executor(thread_pool& pool)
+//		void post(coroutine_handle<> h) -- thread_pool::submit of h.resume()
+//
+//	  class async_task:
+//
+//	  A coroutine that returns nothing and owns itself once started; its
+//	  frame is freed when it finishes. It starts suspended, and spawn()
+//	  starts it on an executor. Like thread_pool tasks it must not throw.
+//
+//		void spawn(executor& exec, async_task task) -- posts task to exec
+//
+//	  class CAsyncQueue<T>:
+//
+//	  A CQueue plus a list of suspended consumers. pop() returns an awaiter:
+//	  if an item is queued, co_await takes it without suspending; otherwise
+//	  the coroutine is linked onto the waiter list, through a hook in the
+//	  awaiter that lives in the coroutine frame, so waiting allocates
+//	  nothing and holds no thread. push() hands its item straight to the
+//	  oldest waiter and posts exactly that one to the queue's executor, or
+//	  queues the item when nobody waits. Waiters are served first come,
+//	  first served. Every method is thread safe; items are stored with
+//	  std::allocator, for the same reason as in thread_pool. The queue
+//	  must outlive its waiters.
+//
+//	  Methods:
+//
+//		inline:
+//		CAsyncQueue(executor& exec) -- waiters are resumed on exec
+//		void push(const T& x), push(T&& x) -- forward to emplace
+//		pop_awaiter pop() -- co_await q.pop() yields the next item
+//		unsigned getSize() const -- items queued
+//		size_t waiting() const -- coroutines suspended in pop
+//
+//		non-inline:
+//		void emplace(Args&&... args) -- gives the item to a waiter or queues it
+//		bool try_pop(T& out) -- takes an item without waiting, false if none
+//
+//    History Log:
+//                           10/17/2026  RD  completed version 1.0
+// ----------------------------------------------------------------------------
+
+#ifndef ASYNC_QUEUE_H
+#define ASYNC_QUEUE_H
+#include <coroutine>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <utility>
+#include "Queue.h"
+#include "IntrusiveList.h"
+#include "ThreadPool.h"
+
+using namespace std;
+
+namespace RD_ADT
+{
+	class executor
+	{
+	public:
+		struct schedule_awaiter
+		{
+			executor& exec;
+			bool await_ready() const noexcept { return false; }
+			void await_suspend(coroutine_handle<> h) { exec.post(h); }
+			void await_resume() const noexcept {}
+		};
+
+		virtual ~executor() {}
+		virtual void post(coroutine_handle<> h) = 0;
+		schedule_awaiter schedule() { return schedule_awaiter{ *this }; }
+	};
+
+	class manual_executor : public executor
+	{
+	public:
+		void post(coroutine_handle<> h) override { m_ready.push(h); }
+		bool run_one()
+		{
+			if (m_ready.empty())
+				return false;
+			m_ready.pop().resume();
+			return true;
+		}
+		size_t run()
+		{
+			size_t n = 0;
+			while (run_one())
+				n++;
+			return n;
+		}
+		unsigned getSize() const { return m_ready.getSize(); }
+
+	private:
+		CQueue<coroutine_handle<> > m_ready; // posted, oldest first
+	};
+
+	class pool_executor : public executor
+	{
+	public:
+		explicit pool_executor(thread_pool& pool) : m_pool(pool) {}
+		void post(coroutine_handle<> h) override { m_pool.submit([h]() { h.resume(); }); }
+
+	private:
+		thread_pool& m_pool;
+	};
+
+	class async_task
+	{
+	public:
+		struct promise_type
+		{
+			async_task get_return_object() { return async_task(coroutine_handle<promise_type>::from_promise(*this)); }
+			suspend_always initial_suspend() noexcept { return {}; }
+			suspend_never final_suspend() noexcept { return {}; } // the frame frees itself
+			void return_void() {}
+			void unhandled_exception() { terminate(); }
+		};
+
+		async_task(async_task&& x) : m_handle(x.m_handle) { x.m_handle = nullptr; }
+		async_task(const async_task&) = delete;
+		async_task& operator=(const async_task&) = delete;
+		~async_task()
+		{
+			if (m_handle)
+				m_handle.destroy(); // never started
+		}
+
+		friend void spawn(executor& exec, async_task task)
+		{
+			coroutine_handle<promise_type> h = task.m_handle;
+			task.m_handle = nullptr;
+			exec.post(h);
+		}
+
+	private:
+		explicit async_task(coroutine_handle<promise_type> h) : m_handle(h) {}
+
+		coroutine_handle<promise_type> m_handle; // null once spawned
+	};
+
+	template <class T>
+	class CAsyncQueue
+	{
+	public:
+		class pop_awaiter
+		{
+		public:
+			explicit pop_awaiter(CAsyncQueue& q) : m_queue(q) {}
+			bool await_ready() { return m_queue.try_pop_into(m_value); }
+			bool await_suspend(coroutine_handle<> h);
+			T await_resume() { return std::move(*m_value); }
+
+			list_hook<pop_awaiter> hook; // on m_waiters while suspended
+		private:
+			friend class CAsyncQueue;
+			CAsyncQueue& m_queue;
+			coroutine_handle<> m_handle;
+			optional<T> m_value; // filled by push before the resume
+		};
+
+		explicit CAsyncQueue(executor& exec) : m_exec(exec) {}
+		CAsyncQueue(const CAsyncQueue&) = delete;
+		CAsyncQueue& operator=(const CAsyncQueue&) = delete;
+
+		void push(const T& x) { emplace(x); }
+		void push(T&& x) { emplace(std::move(x)); }
+		template <class... Args>
+		void emplace(Args&&... args);
+		pop_awaiter pop() { return pop_awaiter(*this); }
+		bool try_pop(T& out);
+
+		unsigned getSize() const
+		{
+			lock_guard<mutex> guard(m_lock);
+			return m_items.getSize();
+		}
+		size_t waiting() const
+		{
+			lock_guard<mutex> guard(m_lock);
+			return m_waiters.size();
+		}
+
+	private:
+		bool try_pop_into(optional<T>& out);
+
+		executor& m_exec;
+		mutable mutex m_lock; // guards m_items and m_waiters
+		CQueue<T, allocator<T> > m_items; // only while nobody waits
+		intrusive_list<pop_awaiter, &pop_awaiter::hook> m_waiters; // oldest first, only while m_items is empty
+	};
+
+	//-----------------------------------------------------------------------------
+	//    Class:			CAsyncQueue
+	//	  Method:			emplace(Args&&... args)
+	//
+	//	  Description:		builds an item from args; if a coroutine waits the
+	//						item goes straight into its awaiter and only that
+	//						coroutine is posted, otherwise the item is queued
+	//
+	//    Calls:            intrusive_list::pop_front(), executor::post(),
+	//						CQueue::emplace()
+	//    Called By:		push(), callers
+	//
+	//    Parameters:		Args&&... args
+	//
+	//    History Log:
+	//                      10/17/2026 RD completed version
+	//-----------------------------------------------------------------------------
+
+	template <class T>
+	template <class... Args>
+	void CAsyncQueue<T>::emplace(Args&&... args)
+	{
+		coroutine_handle<> waiter;
+		{
+			lock_guard<mutex> guard(m_lock);
+			if (m_waiters.empty())
+			{
+				m_items.emplace(std::forward<Args>(args)...);
+				return;
+			}
+			pop_awaiter& w = m_waiters.front();
+			w.m_value.emplace(std::forward<Args>(args)...);
+			m_waiters.pop_front();
+			waiter = w.m_handle;
+		}
+		m_exec.post(waiter);
+	}
+
+	//-----------------------------------------------------------------------------
+	//    Class:			CAsyncQueue
+	//	  Method:			try_pop(T& out)
+	//
+	//	  Description:		moves the oldest item into out without waiting
+	//	  Return:			false if no item was queued
+	//
+	//    Calls:            try_pop_into()
+	//    Called By:		callers
+	//
+	//    Parameters:		T& out
+	//
+	//    History Log:
+	//                      10/17/2026 RD completed version
+	//-----------------------------------------------------------------------------
+
+	template <class T>
+	bool CAsyncQueue<T>::try_pop(T& out)
+	{
+		optional<T> value;
+		if (!try_pop_into(value))
+			return false;
+		out = std::move(*value);
+		return true;
+	}
+
+	//-----------------------------------------------------------------------------
+	//    Class:			CAsyncQueue
+	//	  Method:			try_pop_into(optional<T>& out)
+	//
+	//	  Description:		moves the oldest item into out under the lock
+	//	  Return:			false if no item was queued
+	//
+	//    Calls:            CQueue::pop()
+	//    Called By:		try_pop(), pop_awaiter::await_ready()
+	//
+	//    Parameters:		optional<T>& out
+	//
+	//    History Log:
+	//                      10/17/2026 RD completed version
+	//-----------------------------------------------------------------------------
+
+	template <class T>
+	bool CAsyncQueue<T>::try_pop_into(optional<T>& out)
+	{
+		lock_guard<mutex> guard(m_lock);
+		if (m_items.empty())
+			return false;
+		out.emplace(m_items.pop());
+		return true;
+	}
+
+	//-----------------------------------------------------------------------------
+	//    Class:			CAsyncQueue<T>::pop_awaiter
+	//	  Method:			await_suspend(coroutine_handle<> h)
+	//
+	//	  Description:		takes an item pushed since await_ready looked, or
+	//						links this awaiter onto the waiter list. Once the
+	//						lock is dropped a push may resume h on another
+	//						thread, so nothing here touches the awaiter after
+	//	  Return:			true to stay suspended, false to carry on with
+	//						the item taken
+	//
+	//    Calls:            CQueue::pop(), intrusive_list::push_back()
+	//    Called By:		co_await
+	//
+	//    Parameters:		coroutine_handle<> h -- the waiting coroutine
+	//
+	//    History Log:
+	//                      10/17/2026 RD completed version
+	//-----------------------------------------------------------------------------
+
+	template <class T>
+	bool CAsyncQueue<T>::pop_awaiter::await_suspend(coroutine_handle<> h)
+	{
+		lock_guard<mutex> guard(m_queue.m_lock);
+		if (!m_queue.m_items.empty())
+		{
+			m_value.emplace(m_queue.m_items.pop());
+			return false;
+		}
+		m_handle = h;
+		m_queue.m_waiters.push_back(*this);
+		return true;
+	}
+}
+
+#endif
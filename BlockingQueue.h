@@ -0,0 +1,498 @@
+//-----------------------------------------------------------------------------
+//   File: BlockingQueue.h
+//-----------------------------------------------------------------------------
+
+//-------------------------------------------------------------------------------------------
+//    Class:			CBlockingQueue
+//
+//    File:             BlockingQueue.h
+//
+//    Title:            CBlockingQueue Class
+//
+//    Description:		This file contains the class definition for
+//						CBlockingQueue, a CQueue guarded by a mutex whose
+//						consumers can wait for elements and whose producers
+//						can wait for room, with close() for shutdown
+//
+//    Programmer:		Reinaldo Daniswara
+//
+//    Date:             10/17/2026
+//
+//    Version:          1.0
+//
+//   Environment:		Intel COre i7
+//						Software: MS Windows 10 for execution;
+//						Compiles under Microsoft Visual Studio 2015
+//
+//	  class CBlockingQueue<T, Alloc>:
+//
+//	  The lock is held only to link or unlink cells: a push builds its cell
+//	  in a one element list first and links it with CQueue::push_bulk, a pop
+//	  detaches the front cell with CQueue::pop_bulk and moves the element
+//	  out after unlocking, so allocation, construction and destruction all
+//	  happen outside the lock. Waiting consumers and producers are counted
+//	  under the lock; a push of n elements wakes at most n waiting consumers
+//	  and none if nobody waits, and a pop wakes producers only on a bounded
+//	  queue with producers waiting, so no notify is spent on a thread that
+//	  has nothing to do. After close() pushes fail and pops return what is
+//	  left, then report the queue drained.
+//
+//	  Template Parameters:
+//		T -- element type
+//		Alloc -- allocator for the cells; allocator<T> by default since cells
+//				 are built on one thread and freed on another (see Pool.h)
+//
+//	  Methods:
+//
+//		inline:
+//		CBlockingQueue(size_t capacity = 0) -- 0 means unbounded
+//		~CBlockingQueue() -- implicit, no thread may still be using the queue
+//		unsigned getSize() const, bool empty() const -- under the lock
+//		size_t capacity() const, bool closed() const
+//		bool push(const T&), push(T&&) -- forward to emplace
+//		bool try_push(const T&), try_push(T&&) -- false instead of waiting
+//								for room, or if closed; x is kept then
+//		bool try_pop(T& out) -- moves the front element into out if any
+//
+//		non-inline:
+//		bool emplace(Args&&... args) -- waits for room, then links a new
+//								element at the back; false if closed
+//		bool push_bulk(list<T, Alloc>&& batch) -- waits until the whole batch
+//								fits, or the queue is empty, and links it at
+//								once; false and batch untouched if closed
+//		bool pop_wait(T& out) -- waits for an element and moves it into
+//								out; false once closed and drained
+//		bool pop_for(T& out, duration timeout) -- pop_wait giving up after
+//								timeout
+//		size_t pop_bulk_wait(list<T, Alloc>& out, size_t max) -- waits for
+//								an element, then moves up to max onto the
+//								back of out; 0 once closed and drained
+//		void close() -- refuses further pushes and wakes every waiter
+//
+//		private:
+//		bool fits(size_t n) const -- room for n more elements
+//		void link(batch_type& batch, unique_lock<mutex>& guard) -- links,
+//								unlocks, wakes consumers
+//		batch_type unlink(size_t n, unique_lock<mutex>& guard) -- unlinks,
+//								unlocks, wakes producers
+//		static void wake(condition_variable&, unsigned waiting, size_t n)
+//								-- notifies at most n of the waiting threads
+//
+//    History Log:
+//                           10/17/2026  RD  completed version 1.0
+// ----------------------------------------------------------------------------
+
+#ifndef BLOCKING_QUEUE_H
+#define BLOCKING_QUEUE_H
+#include <chrono>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include "Queue.h"
+
+using namespace std;
+
+namespace RD_ADT
+{
+	template <class T, class Alloc = allocator<T> >
+	class CBlockingQueue
+	{
+	public:
+		typedef list<T, Alloc> batch_type;
+
+		explicit CBlockingQueue(size_t capacity = 0)
+			: m_capacity(capacity), m_closed(false), m_waitingConsumers(0), m_waitingProducers(0) {}
+		CBlockingQueue(const CBlockingQueue&) = delete;
+		CBlockingQueue& operator=(const CBlockingQueue&) = delete;
+
+		unsigned getSize() const { lock_guard<mutex> guard(m_lock); return m_items.getSize(); }
+		bool empty() const { lock_guard<mutex> guard(m_lock); return m_items.empty(); }
+		size_t capacity() const { return m_capacity; }
+		bool closed() const { lock_guard<mutex> guard(m_lock); return m_closed; }
+
+		bool push(const T& element) { return emplace(element); }
+		bool push(T&& element) { return emplace(std::move(element)); }
+		template <class... Args>
+		bool emplace(Args&&... args);
+		bool push_bulk(batch_type&& batch);
+		bool try_push(const T& element) { T copy(element); return try_push(std::move(copy)); }
+		bool try_push(T&& element);
+
+		bool pop_wait(T& out);
+		template <class Rep, class Period>
+		bool pop_for(T& out, const chrono::duration<Rep, Period>& timeout);
+		bool try_pop(T& out);
+		size_t pop_bulk_wait(batch_type& out, size_t max);
+
+		void close();
+
+	private:
+		bool fits(size_t n) const
+		{
+			size_t size = m_items.getSize();
+			return m_capacity == 0 || size == 0 || size + n <= m_capacity;
+		}
+		void link(batch_type& batch, unique_lock<mutex>& guard);
+		batch_type unlink(size_t n, unique_lock<mutex>& guard);
+		static void wake(condition_variable& cv, unsigned waiting, size_t n);
+
+		mutable mutex m_lock; // guards everything below
+		condition_variable m_notEmpty; // consumers wait here
+		condition_variable m_notFull; // producers wait here
+		CQueue<T, Alloc> m_items;
+		size_t m_capacity; // 0 for unbounded
+		bool m_closed;
+		unsigned m_waitingConsumers;
+		unsigned m_waitingProducers;
+	};
+
+	//-----------------------------------------------------------------------------
+	//    Class:			CBlockingQueue
+	//	  Method:			wake(condition_variable& cv, unsigned waiting, size_t n)
+	//
+	//	  Description:		n elements or slots became available: notifies
+	//						one waiter per unit, everyone if that covers them
+	//						all, nobody if nobody waits
+	//
+	//    Calls:            none
+	//    Called By:		link(), unlink()
+	//
+	//    Parameters:		condition_variable& cv, unsigned waiting -- read
+	//						under the lock, size_t n
+	//
+	//    History Log:
+	//                      10/17/2026 RD completed version
+	//-----------------------------------------------------------------------------
+
+	template <class T, class Alloc>
+	void CBlockingQueue<T, Alloc>::wake(condition_variable& cv, unsigned waiting, size_t n)
+	{
+		if (waiting == 0 || n == 0)
+			return;
+		if (n >= waiting)
+			cv.notify_all();
+		else
+			for (size_t i = 0; i < n; i++)
+				cv.notify_one();
+	}
+
+	//-----------------------------------------------------------------------------
+	//    Class:			CBlockingQueue
+	//	  Method:			link(batch_type& batch, unique_lock<mutex>& guard)
+	//
+	//	  Description:		links batch at the back, then unlocks and wakes
+	//						as many consumers as there are new elements
+	//
+	//    Calls:            CQueue::push_bulk(), wake()
+	//    Called By:		push_bulk(), try_push()
+	//
+	//    Parameters:		batch_type& batch, unique_lock<mutex>& guard --
+	//						holding m_lock
+	//
+	//    History Log:
+	//                      10/17/2026 RD completed version
+	//-----------------------------------------------------------------------------
+
+	template <class T, class Alloc>
+	void CBlockingQueue<T, Alloc>::link(batch_type& batch, unique_lock<mutex>& guard)
+	{
+		size_t n = batch.getSize();
+		m_items.push_bulk(std::move(batch));
+		unsigned waiting = m_waitingConsumers;
+		guard.unlock();
+		wake(m_notEmpty, waiting, n);
+	}
+
+	//-----------------------------------------------------------------------------
+	//    Class:			CBlockingQueue
+	//	  Method:			unlink(size_t n, unique_lock<mutex>& guard)
+	//
+	//	  Description:		detaches the first n cells, then unlocks and, on
+	//						a bounded queue, wakes as many producers as
+	//						slots were freed
+	//	  Return:			the detached cells
+	//
+	//    Calls:            CQueue::pop_bulk(), wake()
+	//    Called By:		pop_wait(), pop_for(), try_pop(), pop_bulk_wait()
+	//
+	//    Parameters:		size_t n, unique_lock<mutex>& guard -- holding m_lock
+	//
+	//    History Log:
+	//                      10/17/2026 RD completed version
+	//-----------------------------------------------------------------------------
+
+	template <class T, class Alloc>
+	typename CBlockingQueue<T, Alloc>::batch_type CBlockingQueue<T, Alloc>::unlink(size_t n, unique_lock<mutex>& guard)
+	{
+		batch_type taken = m_items.pop_bulk(n);
+		unsigned waiting = m_capacity != 0 ? m_waitingProducers : 0;
+		guard.unlock();
+		wake(m_notFull, waiting, taken.getSize());
+		return taken;
+	}
+
+	//-----------------------------------------------------------------------------
+	//    Class:			CBlockingQueue
+	//	  Method:			emplace(Args&&... args)
+	//
+	//	  Description:		builds the element in a cell of its own, then
+	//						waits for room and links it
+	//	  Return:			false if the queue is closed; the element is
+	//						dropped
+	//
+	//    Calls:            push_bulk()
+	//    Called By:		push()
+	//
+	//    Parameters:		Args&&... args
+	//
+	//    History Log:
+	//                      10/17/2026 RD completed version
+	//-----------------------------------------------------------------------------
+
+	template <class T, class Alloc>
+	template <class... Args>
+	bool CBlockingQueue<T, Alloc>::emplace(Args&&... args)
+	{
+		batch_type one;
+		one.emplace_back(std::forward<Args>(args)...);
+		return push_bulk(std::move(one));
+	}
+
+	//-----------------------------------------------------------------------------
+	//    Class:			CBlockingQueue
+	//	  Method:			push_bulk(batch_type&& batch)
+	//
+	//	  Description:		waits until the whole batch fits, or the queue is
+	//						empty for a batch larger than the capacity, then
+	//						links it with one lock and wakes up to its size
+	//						in consumers
+	//	  Return:			false if the queue is closed; batch is untouched
+	//
+	//    Calls:            fits(), link()
+	//    Called By:		emplace(), main
+	//
+	//    Parameters:		batch_type&& batch
+	//
+	//    History Log:
+	//                      10/17/2026 RD completed version
+	//-----------------------------------------------------------------------------
+
+	template <class T, class Alloc>
+	bool CBlockingQueue<T, Alloc>::push_bulk(batch_type&& batch)
+	{
+		unique_lock<mutex> guard(m_lock);
+		while (!m_closed && !fits(batch.getSize()))
+		{
+			m_waitingProducers++;
+			m_notFull.wait(guard);
+			m_waitingProducers--;
+		}
+		if (m_closed)
+			return false;
+		if (!batch.empty())
+			link(batch, guard);
+		return true;
+	}
+
+	//-----------------------------------------------------------------------------
+	//    Class:			CBlockingQueue
+	//	  Method:			try_push(T&& element)
+	//
+	//	  Description:		links element if there is room right now
+	//	  Return:			false if full or closed; element is then moved
+	//						back
+	//
+	//    Calls:            fits(), link()
+	//    Called By:		try_push(const T&), main
+	//
+	//    Parameters:		T&& element
+	//
+	//    History Log:
+	//                      10/17/2026 RD completed version
+	//-----------------------------------------------------------------------------
+
+	template <class T, class Alloc>
+	bool CBlockingQueue<T, Alloc>::try_push(T&& element)
+	{
+		batch_type one;
+		one.push_back(std::move(element));
+		unique_lock<mutex> guard(m_lock);
+		if (m_closed || !fits(1))
+		{
+			guard.unlock();
+			element = one.pop_front();
+			return false;
+		}
+		link(one, guard);
+		return true;
+	}
+
+	//-----------------------------------------------------------------------------
+	//    Class:			CBlockingQueue
+	//	  Method:			pop_wait(T& out)
+	//
+	//	  Description:		waits until there is an element or the queue is
+	//						closed, then detaches the front cell and moves
+	//						its element into out after unlocking
+	//	  Return:			false once the queue is closed and drained
+	//
+	//    Calls:            unlink()
+	//    Called By:		main
+	//
+	//    Parameters:		T& out
+	//
+	//    History Log:
+	//                      10/17/2026 RD completed version
+	//-----------------------------------------------------------------------------
+
+	template <class T, class Alloc>
+	bool CBlockingQueue<T, Alloc>::pop_wait(T& out)
+	{
+		unique_lock<mutex> guard(m_lock);
+		while (m_items.empty() && !m_closed)
+		{
+			m_waitingConsumers++;
+			m_notEmpty.wait(guard);
+			m_waitingConsumers--;
+		}
+		if (m_items.empty())
+			return false;
+		batch_type one = unlink(1, guard);
+		out = one.pop_front();
+		return true;
+	}
+
+	//-----------------------------------------------------------------------------
+	//    Class:			CBlockingQueue
+	//	  Method:			pop_for(T& out, const chrono::duration<Rep, Period>& timeout)
+	//
+	//	  Description:		pop_wait() that gives up once timeout has passed
+	//	  Return:			false on timeout, or once closed and drained
+	//
+	//    Calls:            unlink()
+	//    Called By:		main
+	//
+	//    Parameters:		T& out, timeout
+	//
+	//    History Log:
+	//                      10/17/2026 RD completed version
+	//-----------------------------------------------------------------------------
+
+	template <class T, class Alloc>
+	template <class Rep, class Period>
+	bool CBlockingQueue<T, Alloc>::pop_for(T& out, const chrono::duration<Rep, Period>& timeout)
+	{
+		chrono::steady_clock::time_point deadline = chrono::steady_clock::now()
+			+ chrono::duration_cast<chrono::steady_clock::duration>(timeout);
+		unique_lock<mutex> guard(m_lock);
+		while (m_items.empty() && !m_closed)
+		{
+			m_waitingConsumers++;
+			cv_status status = m_notEmpty.wait_until(guard, deadline);
+			m_waitingConsumers--;
+			if (status == cv_status::timeout)
+				break;
+		}
+		if (m_items.empty())
+			return false;
+		batch_type one = unlink(1, guard);
+		out = one.pop_front();
+		return true;
+	}
+
+	//-----------------------------------------------------------------------------
+	//    Class:			CBlockingQueue
+	//	  Method:			try_pop(T& out)
+	//
+	//	  Description:		moves the front element into out if there is one
+	//	  Return:			false if the queue is empty
+	//
+	//    Calls:            unlink()
+	//    Called By:		main
+	//
+	//    Parameters:		T& out
+	//
+	//    History Log:
+	//                      10/17/2026 RD completed version
+	//-----------------------------------------------------------------------------
+
+	template <class T, class Alloc>
+	bool CBlockingQueue<T, Alloc>::try_pop(T& out)
+	{
+		unique_lock<mutex> guard(m_lock);
+		if (m_items.empty())
+			return false;
+		batch_type one = unlink(1, guard);
+		out = one.pop_front();
+		return true;
+	}
+
+	//-----------------------------------------------------------------------------
+	//    Class:			CBlockingQueue
+	//	  Method:			pop_bulk_wait(batch_type& out, size_t max)
+	//
+	//	  Description:		waits until there is an element or the queue is
+	//						closed, then detaches up to max cells with one
+	//						lock and links them onto the back of out
+	//	  Return:			number of elements taken, 0 once closed and
+	//						drained
+	//
+	//    Calls:            unlink(), list::append()
+	//    Called By:		main
+	//
+	//    Parameters:		batch_type& out, size_t max
+	//
+	//    History Log:
+	//                      10/17/2026 RD completed version
+	//-----------------------------------------------------------------------------
+
+	template <class T, class Alloc>
+	size_t CBlockingQueue<T, Alloc>::pop_bulk_wait(batch_type& out, size_t max)
+	{
+		if (max == 0)
+			return 0;
+		unique_lock<mutex> guard(m_lock);
+		while (m_items.empty() && !m_closed)
+		{
+			m_waitingConsumers++;
+			m_notEmpty.wait(guard);
+			m_waitingConsumers--;
+		}
+		if (m_items.empty())
+			return 0;
+		batch_type taken = unlink(max, guard);
+		size_t n = taken.getSize();
+		out.append(std::move(taken));
+		return n;
+	}
+
+	//-----------------------------------------------------------------------------
+	//    Class:			CBlockingQueue
+	//	  Method:			close()
+	//
+	//	  Description:		refuses further pushes and wakes every waiting
+	//						thread; consumers go on popping what is left
+	//
+	//    Calls:            none
+	//    Called By:		main
+	//
+	//    Parameters:		none
+	//
+	//    History Log:
+	//                      10/17/2026 RD completed version
+	//-----------------------------------------------------------------------------
+
+	template <class T, class Alloc>
+	void CBlockingQueue<T, Alloc>::close()
+	{
+		{
+			lock_guard<mutex> guard(m_lock);
+			m_closed = true;
+		}
+		m_notEmpty.notify_all();
+		m_notFull.notify_all();
+	}
+}
+
+#endif
@@ -0,0 +1,714 @@
+//-----------------------------------------------------------------------------
+//   File: CompactList.h
+//-----------------------------------------------------------------------------
+
+//-----------------------------------------------------------------------------
+//   Title: compact_list Class
+//   Description: This file contains the class definition for compact_list,
+//                the 32-bit index linked variant of list
+//
+//   Programmer: Reinaldo Daniswara
+//
+//   Date: 10/17/2026
+//   Version: 1.0
+//
+//   Environment: Intel Core i7
+//     Software: MS Windows 10 for execution;
+//     Compiles under Microsoft Visual Studio 2015
+//
+//   class compact_list<T, PageBits, Alloc>:
+//
+//     Circular doubly linked list like list<T>, but the cells live in pages
+//     owned by the list and link to each other by 32-bit index instead of by
+//     pointer. A cell is the element plus 8 bytes of links, against 16 bytes
+//     of pointers in a listelem, and there is no per-cell allocation at all:
+//     a list<int> cell takes 12 bytes instead of 24. Cells freed by a pop go
+//     onto a free list threaded through the same links and are reused before
+//     a new page is touched. Pages never move, so references to elements
+//     stay valid until the element is removed.
+//
+//     Meant for very long lists of small elements; an empty list holds no
+//     page, but the first element brings in a whole one.
+//
+//     Template Parameters:
+//       T -- element type
+//       PageBits -- a page holds 2^PageBits cells, 1024 by default
+//       Alloc -- allocator policy, rebound to cell for the pages (see Pool.h)
+//
+//     Properties:
+//       index_type head -- index of the front cell, nil if empty
+//       index_type tail -- index of the back cell, nil if empty
+//       unsigned m_size -- number of elements in the list
+//       vector<cell*> m_pages -- the cell pages, cell i is in page i >> PageBits
+//       index_type m_free -- first freed cell, nil if none
+//       index_type m_used -- cells handed out at least once
+//       cell_allocator m_alloc -- hands out pages
+//
+//     Methods:
+//
+//       inline:
+//         compact_list() -- construct the empty list
+//         ~compact_list() { release(); } -- destructor, frees every page
+//         unsigned getSize()const, size_t size()const -- m_size
+//         begin(), end(), cbegin(), cend(), rbegin(), rend() -- as for list
+//         T& front()const, T& back()const -- first and last element
+//         bool empty()const -- true if no elements
+//         void push_front(const T&), push_front(T&&) -- forward to emplace_front
+//         void push_back(const T&), push_back(T&&) -- forward to emplace_back
+//         size_t footprint()const -- bytes held in pages and the page table
+//
+//       non-inline:
+//         compact_list(const compact_list& x) -- copy constructor
+//         compact_list(compact_list&& x) -- move constructor, takes over the pages
+//         compact_list(InputIt b, InputIt e) -- copies [b, e) from any input iterators
+//         void emplace_front(Args&&... args) -- insert element at front
+//         T pop_front() -- removes front element and returns its data
+//         void emplace_back(Args&&... args) -- insert element at back
+//         T pop_back() -- removes back element and returns its data
+//         iterator erase(const_iterator it) -- removes one element in O(1)
+//         void release() -- destroys every element and frees the pages
+//         void swap(compact_list& x) -- exchanges contents in O(1)
+//         compact_list& operator=(const compact_list&), operator=(compact_list&&)
+//
+//       private:
+//         index_type acquire() -- a free cell, adding a page if needed
+//         void link(index_type i, index_type before) -- links a built cell
+//         void unlink(index_type i) -- destroys a cell's element and frees it
+//
+//    Public Nested Structures:
+//
+//      struct cell -- list cell
+//        index_type next, prev -- links, next chains the free list too
+//        T* data() -- the element
+//
+//     class basic_iterator<Const> -- bidirectional position (cell index);
+//                       iterator and const_iterator, end() holds nil like
+//                       list<T>::iterator holds a null cell. An index only
+//                       means something in the pages of the list that made
+//                       it, so unlike list<T> iterators, swap and moves
+//                       invalidate every iterator of both lists.
+//
+//   History Log:
+//			10/17/2026 RD completed version 1.0
+//			10/17/2026 RD tail's next link is nil, ++ no longer reads the owner's tail
+//-----------------------------------------------------------------------------
+
+#ifndef COMPACT_LIST_H
+#define COMPACT_LIST_H
+#include <iostream>
+#include <cassert>
+#include <cstdint>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include "Pool.h"
+#include "Format.h"
+
+using namespace std;
+
+namespace RD_ADT
+{
+
+	template <class T, unsigned PageBits = 10, class Alloc = pool_allocator<T> >
+	class compact_list
+	{
+	public:
+		typedef uint32_t index_type;
+		static const index_type nil = 0xFFFFFFFFu; // no cell
+		struct cell; // forward declarations
+		template <bool Const> class basic_iterator;
+		typedef basic_iterator<false> iterator;
+		typedef basic_iterator<true> const_iterator;
+		typedef std::reverse_iterator<iterator> reverse_iterator;
+		typedef std::reverse_iterator<const_iterator> const_reverse_iterator;
+		typedef T value_type;
+		typedef size_t size_type;
+		// constructors
+		compact_list() : head(nil), tail(nil), m_size(0), m_free(nil), m_used(0) {}
+		compact_list(const compact_list& x);
+		compact_list(compact_list&& x);
+		template <class InputIt, class = typename iterator_traits<InputIt>::iterator_category>
+		compact_list(InputIt b, InputIt e);
+
+		~compact_list() { release(); }
+		unsigned getSize() const { return m_size; }
+		size_t size() const { return m_size; }
+		iterator begin() { return iterator(head, this); }
+		const_iterator begin() const { return const_iterator(head, this); }
+		iterator end() { return iterator(nil, this); }
+		const_iterator end() const { return const_iterator(nil, this); }
+		const_iterator cbegin() const { return begin(); }
+		const_iterator cend() const { return end(); }
+		reverse_iterator rbegin() { return reverse_iterator(end()); }
+		const_reverse_iterator rbegin() const { return const_reverse_iterator(end()); }
+		reverse_iterator rend() { return reverse_iterator(begin()); }
+		const_reverse_iterator rend() const { return const_reverse_iterator(begin()); }
+		void push_front(const T& datum) { emplace_front(datum); }
+		void push_front(T&& datum) { emplace_front(std::move(datum)); }
+		template <class... Args>
+		void emplace_front(Args&&... args);
+		T pop_front();
+		void push_back(const T& datum) { emplace_back(datum); }
+		void push_back(T&& datum) { emplace_back(std::move(datum)); }
+		template <class... Args>
+		void emplace_back(Args&&... args);
+		T pop_back();
+		T& front() const { return *at(head).data(); }
+		T& back() const { return *at(tail).data(); }
+		bool empty() const { return head == nil; }
+		iterator erase(const_iterator it);
+		void release();
+		void swap(compact_list& x);
+		compact_list& operator=(const compact_list& rlist);
+		compact_list& operator=(compact_list&& rlist);
+		size_t footprint() const { return m_pages.size() * (page_size * sizeof(cell)) + m_pages.capacity() * sizeof(cell*); }
+
+	private:
+		typedef typename allocator_traits<Alloc>::template rebind_alloc<cell> cell_allocator;
+		typedef allocator_traits<cell_allocator> cell_traits;
+		static const index_type page_size = index_type(1) << PageBits;
+		static_assert(PageBits < 32, "a page must be addressable by index_type");
+
+		cell& at(index_type i) const { return m_pages[i >> PageBits][i & (page_size - 1)]; }
+		index_type acquire();
+		void link(index_type i, index_type before);
+		void unlink(index_type i);
+
+		index_type head;
+		index_type tail;
+		unsigned m_size; // number of elements in the list
+		vector<cell*> m_pages; // cell i is in page i >> PageBits
+		index_type m_free; // first freed cell, nil if none
+		index_type m_used; // cells handed out at least once
+		cell_allocator m_alloc; // hands out pages
+	public:
+		struct cell // list cell
+		{
+			alignas(T) unsigned char raw[sizeof(T)];
+			index_type next; // forward link, or the next free cell
+			index_type prev; // backward link
+			T* data() { return reinterpret_cast<T*>(raw); }
+		};
+		// scoped within class compact_list !
+		template <bool Const>
+		class basic_iterator
+		{
+		public:
+			typedef bidirectional_iterator_tag iterator_category;
+			typedef T value_type;
+			typedef ptrdiff_t difference_type;
+			typedef typename conditional<Const, const T*, T*>::type pointer;
+			typedef typename conditional<Const, const T&, T&>::type reference;
+
+			basic_iterator() : index(nil), owner(nullptr) {}
+			basic_iterator(index_type i, const compact_list* o) : index(i), owner(o) {}
+			operator basic_iterator<true>() const { return basic_iterator<true>(index, owner); }
+			basic_iterator& operator++()
+			{
+				if (index == nil)
+					throw runtime_error("nullptr pointer");
+				index = owner->at(index).next;
+				return *this;
+			}
+			basic_iterator& operator--()
+			{
+				if (index == nil)
+				{
+					if (owner == nullptr || owner->tail == nil)
+						throw runtime_error("nullptr pointer");
+					index = owner->tail;
+				}
+				else
+					index = owner->at(index).prev;
+				return *this;
+			}
+			basic_iterator operator++(int) { basic_iterator temp = *this; ++*this; return temp; }
+			basic_iterator operator--(int) { basic_iterator temp = *this; --*this; return temp; }
+			pointer operator->() const { return owner->at(index).data(); }
+			reference operator*() const { return *owner->at(index).data(); }
+			index_type node() const { return index; }
+			friend bool operator==(const basic_iterator& a, const basic_iterator& b) { return a.index == b.index; }
+			friend bool operator!=(const basic_iterator& a, const basic_iterator& b) { return a.index != b.index; }
+		private:
+			index_type index; // current cell, nil once past the tail
+			const compact_list* owner; // list walked, to reach the cells
+		};
+	};
+
+	template <class T, unsigned PageBits, class Alloc>
+	ostream& operator<<(ostream& sout, const compact_list<T, PageBits, Alloc>& x)
+	{
+		return print_list(sout, x);
+	}
+
+	//-----------------------------------------------------------------------------
+	//    Class:			compact_list<T>
+	//	  Method:			compact_list(const compact_list& x)
+	//
+	//	  Description:		Copy constructor, front to back
+	//
+	//    Calls:            push_back()
+	//    Called By:		main
+	//
+	//    Parameters:		const compact_list& x
+	//
+	//    History Log:
+	//                      10/17/2026 RD completed version
+	//-----------------------------------------------------------------------------
+
+	template <class T, unsigned PageBits, class Alloc>
+	compact_list<T, PageBits, Alloc>::compact_list(const compact_list& x)
+		: head(nil), tail(nil), m_size(0), m_free(nil), m_used(0),
+		m_alloc(cell_traits::select_on_container_copy_construction(x.m_alloc))
+	{
+		try
+		{
+			for (const T& datum : x)
+				push_back(datum);
+		}
+		catch (...)
+		{
+			release();
+			throw;
+		}
+	}
+
+	//-----------------------------------------------------------------------------
+	//    Class:			compact_list<T>
+	//	  Method:			compact_list(compact_list&& x)
+	//
+	//	  Description:		Move constructor, takes over the pages of x and
+	//						leaves x empty
+	//
+	//    Calls:            none
+	//    Called By:		main
+	//
+	//    Parameters:		compact_list&& x
+	//
+	//    History Log:
+	//                      10/17/2026 RD completed version
+	//-----------------------------------------------------------------------------
+
+	template <class T, unsigned PageBits, class Alloc>
+	compact_list<T, PageBits, Alloc>::compact_list(compact_list&& x)
+		: head(x.head), tail(x.tail), m_size(x.m_size), m_pages(std::move(x.m_pages)),
+		m_free(x.m_free), m_used(x.m_used), m_alloc(std::move(x.m_alloc))
+	{
+		x.head = x.tail = x.m_free = nil;
+		x.m_size = 0;
+		x.m_used = 0;
+		x.m_pages.clear();
+	}
+
+	//-----------------------------------------------------------------------------
+	//    Class:			compact_list<T>
+	//	  Method:			compact_list(InputIt b, InputIt e)
+	//
+	//	  Description:		constructor using iterators, copies from b to one
+	//						before e
+	//
+	//    Calls:            push_back()
+	//    Called By:		main
+	//
+	//    Parameters:		InputIt b, InputIt e -- any input iterators
+	//
+	//    History Log:
+	//                      10/17/2026 RD completed version
+	//-----------------------------------------------------------------------------
+
+	template <class T, unsigned PageBits, class Alloc>
+	template <class InputIt, class>
+	compact_list<T, PageBits, Alloc>::compact_list(InputIt b, InputIt e)
+		: head(nil), tail(nil), m_size(0), m_free(nil), m_used(0)
+	{
+		try
+		{
+			for (; b != e; ++b)
+				push_back(*b);
+		}
+		catch (...)
+		{
+			release();
+			throw;
+		}
+	}
+
+	//-----------------------------------------------------------------------------
+	//    Class:			compact_list<T>
+	//	  Method:			acquire()
+	//
+	//	  Description:		takes a cell off the free list, or the next never
+	//						used cell, adding a page when the last one is full
+	//	  Return:			index of a cell with no element in it
+	//
+	//    Calls:            cell_traits::allocate()
+	//    Called By:		emplace_front(), emplace_back()
+	//
+	//    Parameters:		none
+	//
+	//    History Log:
+	//                      10/17/2026 RD completed version
+	//-----------------------------------------------------------------------------
+
+	template <class T, unsigned PageBits, class Alloc>
+	typename compact_list<T, PageBits, Alloc>::index_type compact_list<T, PageBits, Alloc>::acquire()
+	{
+		if (m_free != nil)
+		{
+			index_type i = m_free;
+			m_free = at(i).next;
+			return i;
+		}
+		if (m_used == nil)
+			throw runtime_error("Compact list full");
+		if ((m_used >> PageBits) == m_pages.size())
+		{
+			if (m_pages.size() == m_pages.capacity())
+				m_pages.reserve(m_pages.empty() ? 4 : m_pages.size() * 2);
+			m_pages.push_back(cell_traits::allocate(m_alloc, page_size));
+		}
+		return m_used++;
+	}
+
+	//-----------------------------------------------------------------------------
+	//    Class:			compact_list<T>
+	//	  Method:			link(index_type i, index_type before)
+	//
+	//	  Description:		links cell i, element already built, in front
+	//						of before; before == nil means after the tail.
+	//						head is left alone, callers linking in front of
+	//						it move it themselves
+	//
+	//    Calls:            at()
+	//    Called By:		emplace_front(), emplace_back()
+	//
+	//    Parameters:		index_type i, index_type before
+	//
+	//    History Log:
+	//                      10/17/2026 RD completed version
+	//-----------------------------------------------------------------------------
+
+	template <class T, unsigned PageBits, class Alloc>
+	void compact_list<T, PageBits, Alloc>::link(index_type i, index_type before)
+	{
+		cell& c = at(i);
+		c.next = before;
+		if (empty())
+		{
+			c.prev = nil;
+			head = tail = i;
+		}
+		else if (before == nil)
+		{
+			c.prev = tail;
+			at(tail).next = i;
+			tail = i;
+		}
+		else
+		{
+			c.prev = at(before).prev;
+			if (c.prev != nil)
+				at(c.prev).next = i;
+			at(before).prev = i;
+		}
+		m_size++;
+	}
+
+	//-----------------------------------------------------------------------------
+	//    Class:			compact_list<T>
+	//	  Method:			unlink(index_type i)
+	//
+	//	  Description:		takes cell i out of the list, destroys its element
+	//						and puts the cell on the free list
+	//
+	//    Calls:            at()
+	//    Called By:		pop_front(), pop_back(), erase()
+	//
+	//    Parameters:		index_type i
+	//
+	//    History Log:
+	//                      10/17/2026 RD completed version
+	//-----------------------------------------------------------------------------
+
+	template <class T, unsigned PageBits, class Alloc>
+	void compact_list<T, PageBits, Alloc>::unlink(index_type i)
+	{
+		cell& c = at(i);
+		if (c.prev != nil)
+			at(c.prev).next = c.next;
+		else
+			head = c.next;
+		if (c.next != nil)
+			at(c.next).prev = c.prev;
+		else
+			tail = c.prev;
+		c.data()->~T();
+		c.next = m_free;
+		m_free = i;
+		m_size--;
+	}
+
+	//-----------------------------------------------------------------------------
+	//    Class:			compact_list<T>
+	//	  Method:			emplace_front(Args&&... args)
+	//
+	//	  Description:		insert element at front of list, built in place
+	//						from args
+	//
+	//    Calls:            acquire(), link()
+	//    Called By:		main, push_front()
+	//
+	//    Parameters:		Args&&... args
+	//
+	//    History Log:
+	//                      10/17/2026 RD completed version
+	//-----------------------------------------------------------------------------
+
+	template <class T, unsigned PageBits, class Alloc>
+	template <class... Args>
+	void compact_list<T, PageBits, Alloc>::emplace_front(Args&&... args)
+	{
+		index_type i = acquire();
+		try { ::new (static_cast<void*>(at(i).data())) T(std::forward<Args>(args)...); }
+		catch (...)
+		{
+			at(i).next = m_free;
+			m_free = i;
+			throw;
+		}
+		link(i, head);
+		head = i;
+	}
+
+	//-----------------------------------------------------------------------------
+	//    Class:			compact_list<T>
+	//	  Method:			emplace_back(Args&&... args)
+	//
+	//	  Description:		insert element at back of list, built in place
+	//						from args
+	//
+	//    Calls:            acquire(), link()
+	//    Called By:		main, push_back()
+	//
+	//    Parameters:		Args&&... args
+	//
+	//    History Log:
+	//                      10/17/2026 RD completed version
+	//-----------------------------------------------------------------------------
+
+	template <class T, unsigned PageBits, class Alloc>
+	template <class... Args>
+	void compact_list<T, PageBits, Alloc>::emplace_back(Args&&... args)
+	{
+		index_type i = acquire();
+		try { ::new (static_cast<void*>(at(i).data())) T(std::forward<Args>(args)...); }
+		catch (...)
+		{
+			at(i).next = m_free;
+			m_free = i;
+			throw;
+		}
+		link(i, nil);
+	}
+
+	//-----------------------------------------------------------------------------
+	//    Class:			compact_list<T>
+	//	  Method:			pop_front()
+	//
+	//	  Description:		removes the front element
+	//	  Return:			its data, moved out
+	//
+	//    Calls:            unlink()
+	//    Called By:		main
+	//
+	//    Parameters:		none
+	//
+	//    History Log:
+	//                      10/17/2026 RD completed version
+	//-----------------------------------------------------------------------------
+
+	template <class T, unsigned PageBits, class Alloc>
+	T compact_list<T, PageBits, Alloc>::pop_front()
+	{
+		if (head == nil)
+			throw runtime_error("Empty list");
+		T data(std::move(*at(head).data()));
+		unlink(head);
+		return data;
+	}
+
+	//-----------------------------------------------------------------------------
+	//    Class:			compact_list<T>
+	//	  Method:			pop_back()
+	//
+	//	  Description:		removes the back element
+	//	  Return:			its data, moved out
+	//
+	//    Calls:            unlink()
+	//    Called By:		main
+	//
+	//    Parameters:		none
+	//
+	//    History Log:
+	//                      10/17/2026 RD completed version
+	//-----------------------------------------------------------------------------
+
+	template <class T, unsigned PageBits, class Alloc>
+	T compact_list<T, PageBits, Alloc>::pop_back()
+	{
+		if (tail == nil)
+			throw runtime_error("Empty list");
+		T data(std::move(*at(tail).data()));
+		unlink(tail);
+		return data;
+	}
+
+	//-----------------------------------------------------------------------------
+	//    Class:			compact_list<T>
+	//	  Method:			erase(const_iterator it)
+	//
+	//	  Description:		removes the element at it in O(1)
+	//	  Return:			iterator at the next element, or end()
+	//
+	//    Calls:            unlink()
+	//    Called By:		n/a
+	//
+	//    Parameters:		const_iterator it
+	//
+	//    History Log:
+	//                      10/17/2026 RD completed version
+	//-----------------------------------------------------------------------------
+
+	template <class T, unsigned PageBits, class Alloc>
+	typename compact_list<T, PageBits, Alloc>::iterator compact_list<T, PageBits, Alloc>::erase(const_iterator it)
+	{
+		index_type i = it.node();
+		if (i == nil)
+			throw runtime_error("nullptr pointer");
+		index_type next = at(i).next;
+		unlink(i);
+		return iterator(next, this);
+	}
+
+	//-----------------------------------------------------------------------------
+	//    Class:			compact_list<T>
+	//	  Method:			release()
+	//
+	//	  Description:		destroys every element, front to back, then
+	//						frees every page
+	//
+	//    Calls:            cell_traits::deallocate()
+	//    Called By:		~compact_list(), operator=()
+	//
+	//    Parameters:		none
+	//
+	//    History Log:
+	//                      10/17/2026 RD completed version
+	//-----------------------------------------------------------------------------
+
+	template <class T, unsigned PageBits, class Alloc>
+	void compact_list<T, PageBits, Alloc>::release()
+	{
+		index_type i = head;
+		for (unsigned n = 0; n < m_size; n++)
+		{
+			cell& c = at(i);
+			i = c.next;
+			c.data()->~T();
+		}
+		for (cell* page : m_pages)
+			cell_traits::deallocate(m_alloc, page, page_size);
+		m_pages.clear();
+		head = tail = m_free = nil;
+		m_size = 0;
+		m_used = 0;
+	}
+
+	//-----------------------------------------------------------------------------
+	//    Class:			compact_list<T>
+	//	  Method:			swap(compact_list& x)
+	//
+	//	  Description:		exchanges the contents of two lists in O(1); the
+	//						allocators must compare equal
+	//
+	//    Calls:            none
+	//    Called By:		operator=(compact_list&&)
+	//
+	//    Parameters:		compact_list& x
+	//
+	//    History Log:
+	//                      10/17/2026 RD completed version
+	//-----------------------------------------------------------------------------
+
+	template <class T, unsigned PageBits, class Alloc>
+	void compact_list<T, PageBits, Alloc>::swap(compact_list& x)
+	{
+		assert(m_alloc == x.m_alloc);
+		std::swap(head, x.head);
+		std::swap(tail, x.tail);
+		std::swap(m_size, x.m_size);
+		m_pages.swap(x.m_pages);
+		std::swap(m_free, x.m_free);
+		std::swap(m_used, x.m_used);
+	}
+
+	//-----------------------------------------------------------------------------
+	//    Class:			compact_list<T>
+	//	  Method:			operator=(const compact_list& rlist)
+	//
+	//	  Description:		replaces the contents with a copy of rlist
+	//	  Return:			*this
+	//
+	//    Calls:            swap()
+	//    Called By:		n/a
+	//
+	//    Parameters:		const compact_list& rlist
+	//
+	//    History Log:
+	//                      10/17/2026 RD completed version
+	//-----------------------------------------------------------------------------
+
+	template <class T, unsigned PageBits, class Alloc>
+	compact_list<T, PageBits, Alloc>& compact_list<T, PageBits, Alloc>::operator=(const compact_list& rlist)
+	{
+		if (&rlist != this)
+		{
+			compact_list copy(rlist);
+			swap(copy);
+		}
+		return *this;
+	}
+
+	//-----------------------------------------------------------------------------
+	//    Class:			compact_list<T>
+	//	  Method:			operator=(compact_list&& rlist)
+	//
+	//	  Description:		takes over the pages of rlist, leaving it empty
+	//	  Return:			*this
+	//
+	//    Calls:            release(), swap()
+	//    Called By:		n/a
+	//
+	//    Parameters:		compact_list&& rlist
+	//
+	//    History Log:
+	//                      10/17/2026 RD completed version
+	//-----------------------------------------------------------------------------
+
+	template <class T, unsigned PageBits, class Alloc>
+	compact_list<T, PageBits, Alloc>& compact_list<T, PageBits, Alloc>::operator=(compact_list&& rlist)
+	{
+		if (&rlist != this)
+		{
+			release();
+			swap(rlist);
+		}
+		return *this;
+	}
+}
+
+#endif
@@ -0,0 +1,285 @@
+//-----------------------------------------------------------------------------
+//   File: ConcurrentQueue.h
+//-----------------------------------------------------------------------------
+
+//-------------------------------------------------------------------------------------------
+//    Class:			CConcurrentQueue
+//
+//    File:             ConcurrentQueue.h
+//
+//    Title:            CConcurrentQueue Class
+//
+//    Description:		This file contains the class definition for
+//						CConcurrentQueue, a lock-free multi-producer
+//						multi-consumer queue (Michael-Scott) with the
+//						push/pop/empty/getSize surface of CQueue
+//
+//    Programmer:		Reinaldo Daniswara
+//
+//    Date:             10/17/2026
+//
+//    Version:          1.0
+//
+//   Environment:		Intel COre i7
+//						Software: MS Windows 10 for execution;
+//						Compiles under Microsoft Visual Studio 2015
+//
+//	  class CConcurrentQueue<T>:
+//
+//	  The queue is a singly linked chain that always starts with a dummy
+//	  node; head points at the dummy and the front element lives in
+//	  head->next. Producers link at tail with compare-and-swap, consumers
+//	  swing head forward and the old dummy is retired through
+//	  hazard_domain (HazardPointer.h), so no node is freed while another
+//	  thread may still read it. head and tail sit on separate cache lines.
+//
+//	  Methods:
+//
+//		inline:
+//		CConcurrentQueue() -- constructs the empty queue
+//		~CConcurrentQueue() -- destructor, not safe while other threads
+//								still use the queue
+//		unsigned getSize() const -- number of elements, exact when quiescent
+//		bool empty() const -- true if no element is ready to pop
+//		void push(const T&), push(T&&) -- forward to emplace
+//		T pop() -- removes the front element, throws if empty
+//		bool try_pop(T& out) -- moves the front element into out if any
+//
+//		non-inline:
+//		void emplace(Args&&... args) -- links a new element at the tail
+//		bool dequeue(F take) -- unlinks the front element and hands it to
+//								take while it is still protected
+//
+//    History Log:
+//                           10/17/2026  RD  completed version 1.0
+// ----------------------------------------------------------------------------
+
+#ifndef CONCURRENT_QUEUE_H
+#define CONCURRENT_QUEUE_H
+#include <atomic>
+#include <new>
+#include <stdexcept>
+#include <utility>
+#include "HazardPointer.h"
+
+using namespace std;
+
+namespace RD_ADT
+{
+	template <class T>
+	class CConcurrentQueue
+	{
+	public:
+		CConcurrentQueue() : m_size(0)
+		{
+			node* dummy = new node;
+			head.store(dummy);
+			tail.store(dummy);
+		}
+		CConcurrentQueue(const CConcurrentQueue&) = delete;
+		CConcurrentQueue& operator=(const CConcurrentQueue&) = delete;
+		~CConcurrentQueue();
+
+		unsigned getSize() const { long n = m_size.load(memory_order_relaxed); return n < 0 ? 0 : static_cast<unsigned>(n); }
+		bool empty() const;
+
+		void push(const T& element) { emplace(element); }
+		void push(T&& element) { emplace(std::move(element)); }
+		template <class... Args>
+		void emplace(Args&&... args);
+
+		T pop()
+		{
+			alignas(T) unsigned char buf[sizeof(T)];
+			T* p = nullptr;
+			if (!dequeue([&](T& v) { p = ::new (static_cast<void*>(buf)) T(std::move(v)); }))
+				throw runtime_error("Empty list");
+			T data(std::move(*p));
+			p->~T();
+			return data;
+		}
+		bool try_pop(T& out) { return dequeue([&](T& v) { out = std::move(v); }); }
+
+	private:
+		struct node
+		{
+			atomic<node*> next;
+			alignas(T) unsigned char storage[sizeof(T)];
+			node() : next(nullptr) {}
+			T* value() { return reinterpret_cast<T*>(storage); }
+		};
+
+		template <class F>
+		bool dequeue(F take);
+
+		alignas(64) atomic<node*> head; // dummy node, consumers swing it forward
+		alignas(64) atomic<node*> tail; // last node or close behind it
+		alignas(64) atomic<long> m_size;
+	};
+
+	//-----------------------------------------------------------------------------
+	//    Class:			CConcurrentQueue
+	//	  Method:			~CConcurrentQueue()
+	//
+	//	  Description:		destroys the remaining elements and nodes
+	//
+	//    Calls:            none
+	//    Called By:		n/a
+	//
+	//    Parameters:		none
+	//
+	//    History Log:
+	//                      10/17/2026 RD completed version
+	//-----------------------------------------------------------------------------
+
+	template <class T>
+	CConcurrentQueue<T>::~CConcurrentQueue()
+	{
+		node* p = head.load();
+		node* next = p->next.load();
+		delete p; // dummy holds no value
+		while (next != nullptr)
+		{
+			p = next;
+			next = p->next.load();
+			p->value()->~T();
+			delete p;
+		}
+	}
+
+	//-----------------------------------------------------------------------------
+	//    Class:			CConcurrentQueue
+	//	  Method:			empty()const
+	//
+	//	  Description:		true if the dummy has no successor
+	//
+	//    Calls:            hazard_domain::protect()
+	//    Called By:		n/a
+	//
+	//    Parameters:		none
+	//	  Return:			bool
+	//
+	//    History Log:
+	//                      10/17/2026 RD completed version
+	//-----------------------------------------------------------------------------
+
+	template <class T>
+	bool CConcurrentQueue<T>::empty() const
+	{
+		node* h = hazard_domain::protect(0, head);
+		bool result = h->next.load() == nullptr;
+		hazard_domain::clear(0);
+		return result;
+	}
+
+	//-----------------------------------------------------------------------------
+	//    Class:			CConcurrentQueue
+	//	  Method:			emplace(Args&&... args)
+	//
+	//	  Description:		builds the element in a new node and links it
+	//						after the last node, helping a lagging tail along
+	//
+	//    Calls:            hazard_domain::protect(), hazard_domain::clear()
+	//    Called By:		push()
+	//
+	//    Parameters:		Args&&... args
+	//
+	//    History Log:
+	//                      10/17/2026 RD completed version
+	//-----------------------------------------------------------------------------
+
+	template <class T>
+	template <class... Args>
+	void CConcurrentQueue<T>::emplace(Args&&... args)
+	{
+		node* n = new node;
+		try { ::new (static_cast<void*>(n->storage)) T(std::forward<Args>(args)...); }
+		catch (...) { delete n; throw; }
+
+		for (;;)
+		{
+			node* t = hazard_domain::protect(0, tail);
+			node* next = t->next.load();
+			if (t != tail.load())
+				continue;
+			if (next != nullptr)
+			{ // tail is behind, move it on and retry
+				tail.compare_exchange_weak(t, next);
+				continue;
+			}
+			node* expected = nullptr;
+			if (t->next.compare_exchange_weak(expected, n))
+			{
+				tail.compare_exchange_strong(t, n);
+				break;
+			}
+		}
+		hazard_domain::clear(0);
+		m_size.fetch_add(1, memory_order_relaxed);
+	}
+
+	//-----------------------------------------------------------------------------
+	//    Class:			CConcurrentQueue
+	//	  Method:			dequeue(F take)
+	//
+	//	  Description:		swings head from the dummy to its successor, which
+	//						becomes the new dummy; the winner alone moves the
+	//						value out through take, then the old dummy is retired
+	//
+	//    Calls:            hazard_domain::protect(), hazard_domain::retire()
+	//    Called By:		pop(), try_pop()
+	//
+	//    Parameters:		F take -- called with the front element
+	//	  Return:			false if the queue was empty
+	//
+	//    History Log:
+	//                      10/17/2026 RD completed version
+	//-----------------------------------------------------------------------------
+
+	template <class T>
+	template <class F>
+	bool CConcurrentQueue<T>::dequeue(F take)
+	{
+		for (;;)
+		{
+			node* h = hazard_domain::protect(0, head);
+			node* t = tail.load();
+			node* next = h->next.load();
+			hazard_domain::set(1, next);
+			if (h != head.load())
+				continue;
+			if (next == nullptr)
+			{
+				hazard_domain::clear(0);
+				hazard_domain::clear(1);
+				return false;
+			}
+			if (h == t)
+			{ // tail is behind, move it on and retry
+				tail.compare_exchange_weak(t, next);
+				continue;
+			}
+			if (head.compare_exchange_weak(h, next))
+			{
+				m_size.fetch_sub(1, memory_order_relaxed);
+				T* v = next->value();
+				try { take(*v); }
+				catch (...)
+				{
+					v->~T();
+					hazard_domain::clear(0);
+					hazard_domain::clear(1);
+					hazard_domain::retire(h);
+					throw;
+				}
+				v->~T();
+				hazard_domain::clear(0);
+				hazard_domain::clear(1);
+				hazard_domain::retire(h);
+				return true;
+			}
+		}
+	}
+}
+
+#endif
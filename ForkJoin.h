@@ -0,0 +1,466 @@
+//-----------------------------------------------------------------------------
+//   File: ForkJoin.h
+//-----------------------------------------------------------------------------
+
+//-----------------------------------------------------------------------------
+//   Title: fork_join_pool and task_group Classes
+//   Description: This file contains a work stealing task executor for CPU
+//                bound jobs that split themselves into smaller tasks
+//
+//   Programmer: Reinaldo Daniswara
+//
+//   Date: 10/17/2026
+//   Version: 1.0
+//
+//   Environment: Intel Core i7
+//     Software: MS Windows 10 for execution;
+//     Compiles under Microsoft Visual Studio 2015
+//
+//   class fork_join_pool:
+//
+//     Every worker owns a CWorkStealingDeque of tasks. A task spawned on a
+//     worker goes onto that worker's deque, and the worker runs its newest
+//     task next, so a job that splits itself stays on one core while the
+//     pieces are hot. An idle worker steals the oldest task, which is the
+//     biggest piece left, from a victim picked at random, and tasks spawned
+//     from outside go through one locked injection CQueue. Workers with
+//     nothing to run or steal spin briefly, then sleep until a spawn wakes
+//     them; a sleeping worker also rechecks every millisecond, so a
+//     missed wakeup only costs latency. A thread waiting on a task_group
+//     runs tasks itself meanwhile, so a pool with no workers still
+//     finishes every job on the caller, and tasks may wait on groups of
+//     their own.
+//
+//     Methods:
+//
+//       inline:
+//         fork_join_pool(unsigned workers) -- starts workers threads, one
+//                  less than the core count by default
+//         ~fork_join_pool() -- joins the workers; every task_group must
+//                  have been waited for
+//         unsigned size() const -- number of workers
+//
+//       non-inline:
+//         void run(size_t n, F f) -- calls f(0) .. f(n - 1), splitting the
+//                  range in halves as tasks, and returns when all are done,
+//                  rethrowing the first exception
+//
+//       private:
+//         void spawn(task* t) -- onto the calling worker's deque, or the
+//                  injection queue from other threads, then wakes a sleeper
+//         task* find_work() -- own deque, then a steal, then the injection
+//                  queue; nullptr if all are empty
+//         void execute(task* t) -- runs t and retires it from its group
+//         bool has_work() const -- a snapshot of every queue
+//         void work(unsigned index) -- worker thread loop
+//
+//   class task_group:
+//     task_group(fork_join_pool& pool)
+//     ~task_group() -- waits for its tasks, dropping their exceptions
+//     void spawn(F f) -- runs f as a task of this group
+//     void wait() -- runs tasks until every task of the group finished,
+//                    then rethrows the first exception one threw
+//
+//   History Log:
+//			10/17/2026 RD completed version 1.0
+//-----------------------------------------------------------------------------
+
+#ifndef FORK_JOIN_H
+#define FORK_JOIN_H
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include "ThreadPool.h"
+#include "WorkStealingDeque.h"
+
+using namespace std;
+
+namespace RD_ADT
+{
+	class task_group;
+
+	class fork_join_pool
+	{
+	public:
+		explicit fork_join_pool(unsigned workers = thread_pool::default_workers())
+			: m_sleeping(0), m_injected(0), m_stop(false)
+		{
+			for (unsigned i = 0; i < workers; i++)
+				m_deques.emplace_back(new CWorkStealingDeque<task*>);
+			m_threads.reserve(workers);
+			for (unsigned i = 0; i < workers; i++)
+				m_threads.emplace_back([this, i]() { work(i); });
+		}
+		fork_join_pool(const fork_join_pool&) = delete;
+		fork_join_pool& operator=(const fork_join_pool&) = delete;
+		~fork_join_pool()
+		{
+			m_stop.store(true);
+			{
+				lock_guard<mutex> guard(m_sleepLock);
+			}
+			m_wake.notify_all();
+			for (thread& t : m_threads)
+				t.join();
+		}
+
+		unsigned size() const { return static_cast<unsigned>(m_threads.size()); }
+		template <class F>
+		void run(size_t n, F f);
+
+	private:
+		friend class task_group;
+		struct task
+		{
+			function<void()> body;
+			task_group* group;
+		};
+		struct worker_id
+		{
+			fork_join_pool* pool;
+			unsigned index;
+		};
+		static worker_id& current()
+		{
+			thread_local worker_id id = { nullptr, 0 };
+			return id;
+		}
+
+		void spawn(task* t);
+		task* find_work();
+		void execute(task* t);
+		bool has_work() const;
+		void work(unsigned index);
+
+		vector<unique_ptr<CWorkStealingDeque<task*> > > m_deques; // one per worker
+		mutex m_injectLock; // guards m_injectQueue
+		CQueue<task*, allocator<task*> > m_injectQueue; // tasks spawned from outside
+		mutex m_sleepLock;
+		condition_variable m_wake;
+		atomic<unsigned> m_sleeping; // workers about to sleep or asleep
+		atomic<size_t> m_injected; // size of m_injectQueue
+		atomic<bool> m_stop;
+		vector<thread> m_threads;
+	};
+
+	class task_group
+	{
+	public:
+		explicit task_group(fork_join_pool& pool) : m_pool(pool), m_pending(0) {}
+		task_group(const task_group&) = delete;
+		task_group& operator=(const task_group&) = delete;
+		~task_group() { help(); }
+
+		template <class F>
+		void spawn(F f)
+		{
+			m_pending.fetch_add(1, memory_order_relaxed);
+			fork_join_pool::task* t;
+			try { t = new fork_join_pool::task{ function<void()>(std::move(f)), this }; }
+			catch (...) { m_pending.fetch_sub(1, memory_order_relaxed); throw; }
+			try { m_pool.spawn(t); }
+			catch (...) { delete t; m_pending.fetch_sub(1, memory_order_relaxed); throw; }
+		}
+		void wait();
+
+	private:
+		friend class fork_join_pool;
+		void help();
+		void fail(exception_ptr error)
+		{
+			lock_guard<mutex> guard(m_lock);
+			if (!m_error)
+				m_error = error;
+		}
+
+		fork_join_pool& m_pool;
+		atomic<size_t> m_pending; // spawned tasks not finished yet
+		mutex m_lock; // guards m_error
+		exception_ptr m_error;
+	};
+
+	//-----------------------------------------------------------------------------
+	//    Class:			fork_join_pool
+	//	  Method:			spawn(task* t)
+	//
+	//	  Description:		a worker pushes t onto its own deque, any other
+	//						thread onto the injection queue; then one
+	//						sleeping worker, if any, is woken
+	//
+	//    Calls:            CWorkStealingDeque::push(), CQueue::push()
+	//    Called By:		task_group::spawn()
+	//
+	//    Parameters:		task* t
+	//
+	//    History Log:
+	//                      10/17/2026 RD completed version
+	//-----------------------------------------------------------------------------
+
+	inline void fork_join_pool::spawn(task* t)
+	{
+		worker_id& id = current();
+		if (id.pool == this)
+			m_deques[id.index]->push(t);
+		else
+		{
+			lock_guard<mutex> guard(m_injectLock);
+			m_injectQueue.push(t);
+			m_injected.fetch_add(1);
+		}
+		// pairs with the fence in work(): either the sleeper sees the task
+		// or this thread sees the sleeper
+		atomic_thread_fence(memory_order_seq_cst);
+		if (m_sleeping.load(memory_order_relaxed) != 0)
+		{
+			{
+				lock_guard<mutex> guard(m_sleepLock);
+			}
+			m_wake.notify_one();
+		}
+	}
+
+	//-----------------------------------------------------------------------------
+	//    Class:			fork_join_pool
+	//	  Method:			find_work()
+	//
+	//	  Description:		the calling worker's newest task, else the oldest
+	//						task of another worker starting from a random
+	//						one, else the oldest injected task
+	//	  Return:			a task, or nullptr
+	//
+	//    Calls:            CWorkStealingDeque::pop(), steal(), CQueue::pop()
+	//    Called By:		work(), task_group::help()
+	//
+	//    Parameters:		none
+	//
+	//    History Log:
+	//                      10/17/2026 RD completed version
+	//-----------------------------------------------------------------------------
+
+	inline fork_join_pool::task* fork_join_pool::find_work()
+	{
+		task* t = nullptr;
+		worker_id& id = current();
+		bool mine = id.pool == this;
+		if (mine && m_deques[id.index]->pop(t))
+			return t;
+
+		size_t n = m_deques.size();
+		if (n != 0)
+		{
+			thread_local unsigned seed = static_cast<unsigned>(hash<thread::id>()(this_thread::get_id())) | 1;
+			seed ^= seed << 13;
+			seed ^= seed >> 17;
+			seed ^= seed << 5;
+			size_t start = seed % n;
+			for (size_t k = 0; k < n; k++)
+			{
+				size_t victim = (start + k) % n;
+				if ((!mine || victim != id.index) && m_deques[victim]->steal(t))
+					return t;
+			}
+		}
+
+		if (m_injected.load() != 0)
+		{
+			lock_guard<mutex> guard(m_injectLock);
+			if (!m_injectQueue.empty())
+			{
+				m_injected.fetch_sub(1);
+				return m_injectQueue.pop();
+			}
+		}
+		return nullptr;
+	}
+
+	//-----------------------------------------------------------------------------
+	//    Class:			fork_join_pool
+	//	  Method:			execute(task* t)
+	//
+	//	  Description:		runs t, hands an exception to its group, frees
+	//						it and counts it off the group last, since the
+	//						group may be gone right after
+	//
+	//    Calls:            task_group::fail()
+	//    Called By:		work(), task_group::help()
+	//
+	//    Parameters:		task* t
+	//
+	//    History Log:
+	//                      10/17/2026 RD completed version
+	//-----------------------------------------------------------------------------
+
+	inline void fork_join_pool::execute(task* t)
+	{
+		task_group* group = t->group;
+		try { t->body(); }
+		catch (...) { group->fail(current_exception()); }
+		delete t;
+		group->m_pending.fetch_sub(1, memory_order_acq_rel);
+	}
+
+	inline bool fork_join_pool::has_work() const
+	{
+		if (m_injected.load() != 0)
+			return true;
+		for (const unique_ptr<CWorkStealingDeque<task*> >& d : m_deques)
+			if (!d->empty())
+				return true;
+		return false;
+	}
+
+	//-----------------------------------------------------------------------------
+	//    Class:			fork_join_pool
+	//	  Method:			work(unsigned index)
+	//
+	//	  Description:		worker loop: runs whatever find_work() returns;
+	//						when it finds nothing it yields a few times, then
+	//						announces itself as sleeping and sleeps unless a
+	//						task appeared meanwhile. Leaves once stopped with
+	//						nothing left to run
+	//
+	//    Calls:            find_work(), execute(), has_work()
+	//    Called By:		worker threads
+	//
+	//    Parameters:		unsigned index -- its deque
+	//
+	//    History Log:
+	//                      10/17/2026 RD completed version
+	//-----------------------------------------------------------------------------
+
+	inline void fork_join_pool::work(unsigned index)
+	{
+		current() = worker_id{ this, index };
+		const int spins = 64;
+		int idle = 0;
+		for (;;)
+		{
+			task* t = find_work();
+			if (t != nullptr)
+			{
+				execute(t);
+				idle = 0;
+				continue;
+			}
+			if (m_stop.load())
+				return;
+			if (++idle < spins)
+			{
+				this_thread::yield();
+				continue;
+			}
+
+			unique_lock<mutex> guard(m_sleepLock);
+			m_sleeping.fetch_add(1);
+			atomic_thread_fence(memory_order_seq_cst);
+			if (!has_work() && !m_stop.load())
+				m_wake.wait_for(guard, chrono::milliseconds(1));
+			m_sleeping.fetch_sub(1);
+			idle = 0;
+		}
+	}
+
+	//-----------------------------------------------------------------------------
+	//    Class:			task_group
+	//	  Method:			help()
+	//
+	//	  Description:		runs tasks from the pool, this group's or not,
+	//						until every task of this group has finished
+	//
+	//    Calls:            fork_join_pool::find_work(), execute()
+	//    Called By:		wait(), ~task_group()
+	//
+	//    Parameters:		none
+	//
+	//    History Log:
+	//                      10/17/2026 RD completed version
+	//-----------------------------------------------------------------------------
+
+	inline void task_group::help()
+	{
+		while (m_pending.load(memory_order_acquire) != 0)
+		{
+			fork_join_pool::task* t = m_pool.find_work();
+			if (t != nullptr)
+				m_pool.execute(t);
+			else
+				this_thread::yield();
+		}
+	}
+
+	//-----------------------------------------------------------------------------
+	//    Class:			task_group
+	//	  Method:			wait()
+	//
+	//	  Description:		the join: helps until the group's tasks are done,
+	//						then rethrows the first exception one of them
+	//						threw; the group can be reused afterwards
+	//
+	//    Calls:            help()
+	//    Called By:		fork_join_pool::run(), callers
+	//
+	//    Parameters:		none
+	//
+	//    History Log:
+	//                      10/17/2026 RD completed version
+	//-----------------------------------------------------------------------------
+
+	inline void task_group::wait()
+	{
+		help();
+		exception_ptr error;
+		{
+			lock_guard<mutex> guard(m_lock);
+			error = m_error;
+			m_error = nullptr;
+		}
+		if (error)
+			rethrow_exception(error);
+	}
+
+	//-----------------------------------------------------------------------------
+	//    Class:			fork_join_pool
+	//	  Method:			run(size_t n, F f)
+	//
+	//	  Description:		fork/join over the indices 0 .. n - 1: a range is
+	//						halved, the upper half spawned as a task and the
+	//						lower half kept, until one index is left to run.
+	//						The caller starts with the whole range
+	//
+	//    Calls:            task_group::spawn(), task_group::wait()
+	//    Called By:		callers
+	//
+	//    Parameters:		size_t n, F f -- f(size_t i) for each index
+	//
+	//    History Log:
+	//                      10/17/2026 RD completed version
+	//-----------------------------------------------------------------------------
+
+	template <class F>
+	void fork_join_pool::run(size_t n, F f)
+	{
+		function<void(size_t, size_t)> split; // outlives the group's tasks
+		task_group group(*this);
+		split = [&split, &group, &f](size_t lo, size_t hi)
+		{
+			while (hi - lo > 1)
+			{
+				size_t mid = lo + (hi - lo) / 2;
+				group.spawn([&split, mid, hi]() { split(mid, hi); });
+				hi = mid;
+			}
+			f(lo);
+		};
+		if (n != 0)
+			split(0, n);
+		group.wait();
+	}
+}
+
+#endif
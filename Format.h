@@ -0,0 +1,375 @@
+//-----------------------------------------------------------------------------
+//   File: Format.h
+//-----------------------------------------------------------------------------
+
+//-----------------------------------------------------------------------------
+//   Title: list_formatter Class
+//   Description: This file contains the buffered formatter behind
+//                operator<< for list, CQueue, unrolled_list and
+//                persistent_list
+//
+//   Programmer: Reinaldo Daniswara
+//
+//   Date: 10/17/2026
+//   Version: 1.0
+//
+//   Environment: Intel Core i7
+//     Software: MS Windows 10 for execution;
+//     Compiles under Microsoft Visual Studio 2015
+//
+//   list_formatter renders a whole container into one string it keeps
+//   between calls, then hands it to the stream with a single write.
+//   Integers and floating point go through to_chars; floating point uses
+//   the general format at precision 6, so the text matches what a default
+//   ostream prints. Characters and strings are copied as they are, and any
+//   other T is printed with its own operator<< into a reused ostringstream.
+//   With format_options the delimiters can be changed and a long container
+//   cut to its first head and last tail elements around an ellipsis.
+//
+//   struct format_options:
+//     const char *open, *separator, *close -- "(", ", " and ")\n" by default
+//     const char *ellipsis -- stands for the elements left out, "..."
+//     size_t head, tail -- print only the first head and the last tail
+//                          elements when there are more than head + tail;
+//                          head = all (the default) prints everything
+//
+//   class list_formatter:
+//     list_formatter(), list_formatter(const format_options&)
+//     const string& format(It first, It last, size_t n) -- renders the n
+//                  elements of [first, last) into the buffer, returns it
+//     const string& format(const C& x) -- same for a container
+//     ostream& write(ostream& sout, const C& x) -- format, then one write
+//     static list_formatter* local() -- the calling thread's default
+//                  formatter, nullptr while it is already in use
+//
+//   class formatter_lease -- holds local() for one call, or a fresh
+//                  formatter when an element is itself printing a container
+//
+//   Functions:
+//     ostream& print_list(ostream& sout, const C& x) -- what operator<< calls
+//
+//   History Log:
+//			10/17/2026 RD completed version 1.0
+//			10/17/2026 RD stream width pads the whole container and is reset
+//-----------------------------------------------------------------------------
+
+#ifndef FORMAT_H
+#define FORMAT_H
+#include <charconv>
+#include <iostream>
+#include <iterator>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <type_traits>
+
+using namespace std;
+
+namespace RD_ADT
+{
+
+	struct format_options
+	{
+		static const size_t all = static_cast<size_t>(-1);
+
+		const char* open = "(";
+		const char* separator = ", ";
+		const char* close = ")\n";
+		const char* ellipsis = "...";
+		size_t head = all;
+		size_t tail = 0;
+	};
+
+	class list_formatter
+	{
+	public:
+		list_formatter() {}
+		explicit list_formatter(const format_options& options) : m_options(options) {}
+
+		format_options& options() { return m_options; }
+		const string& str() const { return m_buffer; }
+
+		template <class It>
+		const string& format(It first, It last, size_t n);
+		template <class C>
+		const string& format(const C& x) { return format(x.begin(), x.end(), x.getSize()); }
+		template <class C>
+		ostream& write(ostream& sout, const C& x);
+
+		static list_formatter* local();
+
+	private:
+		template <class T>
+		void append(const T& x);
+		template <class T>
+		void append_streamed(const T& x);
+
+		format_options m_options;
+		string m_buffer; // kept between calls so its capacity is reused
+		ostringstream m_stream; // for element types without a fast path
+		bool m_fast = true; // arithmetic through to_chars, off for a stream with custom flags
+		bool m_busy = false; // set while local() has handed this one out
+		friend class formatter_lease;
+	};
+
+	//-----------------------------------------------------------------------------
+	//    Class:			formatter_lease
+	//
+	//	  Description:		borrows the thread's default formatter for one
+	//						operator<<; an element that prints a container
+	//						itself gets a fresh formatter instead of
+	//						overwriting the buffer being filled
+	//
+	//    History Log:
+	//                      10/17/2026 RD completed version
+	//-----------------------------------------------------------------------------
+
+	class formatter_lease
+	{
+	public:
+		formatter_lease() : m_shared(list_formatter::local())
+		{
+			if (m_shared != nullptr)
+				m_shared->m_busy = true;
+		}
+		~formatter_lease()
+		{
+			if (m_shared != nullptr)
+				m_shared->m_busy = false;
+		}
+		formatter_lease(const formatter_lease&) = delete;
+		formatter_lease& operator=(const formatter_lease&) = delete;
+
+		list_formatter& get()
+		{
+			if (m_shared != nullptr)
+				return *m_shared;
+			if (!m_own)
+				m_own.reset(new list_formatter);
+			return *m_own;
+		}
+
+	private:
+		list_formatter* m_shared;
+		unique_ptr<list_formatter> m_own; // only when the shared one is busy
+	};
+
+	//-----------------------------------------------------------------------------
+	//	  Function:			print_list(ostream& sout, const C& x)
+	//
+	//	  Description:		writes x with the default options through the
+	//						thread's formatter; the body of every container's
+	//						operator<<
+	//
+	//    Calls:            formatter_lease, list_formatter::write()
+	//    Called By:		operator<<
+	//
+	//    Parameters:		ostream& sout, const C& x
+	//	  Return:			sout
+	//
+	//    History Log:
+	//                      10/17/2026 RD completed version
+	//-----------------------------------------------------------------------------
+
+	template <class C>
+	ostream& print_list(ostream& sout, const C& x)
+	{
+		formatter_lease lease;
+		return lease.get().write(sout, x);
+	}
+
+	//-----------------------------------------------------------------------------
+	//    Class:			list_formatter
+	//	  Method:			local()
+	//
+	//	  Description:		the calling thread's default formatter, which
+	//						always has the default options
+	//	  Return:			nullptr while it is already in use
+	//
+	//    History Log:
+	//                      10/17/2026 RD completed version
+	//-----------------------------------------------------------------------------
+
+	inline list_formatter* list_formatter::local()
+	{
+		thread_local list_formatter shared;
+		return shared.m_busy ? nullptr : &shared;
+	}
+
+	//-----------------------------------------------------------------------------
+	//    Class:			list_formatter
+	//	  Method:			format(It first, It last, size_t n)
+	//
+	//	  Description:		renders open, the elements with separators and
+	//						close into the buffer. When n is more than head +
+	//						tail, only the first head elements, the ellipsis
+	//						and the last tail elements are rendered; the last
+	//						ones are found by stepping back from last, or
+	//						forward past the cut for forward iterators
+	//
+	//    Calls:            append()
+	//    Called By:		write(), operator<<
+	//
+	//    Parameters:		It first, It last -- forward iterators,
+	//						size_t n -- distance from first to last
+	//	  Return:			the buffer
+	//
+	//    History Log:
+	//                      10/17/2026 RD completed version
+	//-----------------------------------------------------------------------------
+
+	template <class It>
+	const string& list_formatter::format(It first, It last, size_t n)
+	{
+		m_buffer.clear();
+		m_buffer += m_options.open;
+		size_t head = n, tail = 0;
+		bool cut = m_options.head != format_options::all && n > m_options.head
+			&& n - m_options.head > m_options.tail;
+		if (cut)
+		{
+			head = m_options.head;
+			tail = m_options.tail;
+		}
+
+		for (size_t i = 0; i < head; ++i, ++first)
+		{
+			if (i != 0)
+				m_buffer += m_options.separator;
+			append(*first);
+		}
+		if (cut)
+		{
+			if (head != 0)
+				m_buffer += m_options.separator;
+			m_buffer += m_options.ellipsis;
+			if constexpr (is_base_of<bidirectional_iterator_tag, typename iterator_traits<It>::iterator_category>::value)
+			{
+				for (size_t i = 0; i < tail; ++i)
+					--last;
+				first = last;
+			}
+			else
+			{
+				for (size_t i = head; i < n - tail; ++i)
+					++first;
+			}
+			for (size_t i = 0; i < tail; ++i, ++first)
+			{
+				m_buffer += m_options.separator;
+				append(*first);
+			}
+		}
+		m_buffer += m_options.close;
+		return m_buffer;
+	}
+
+	//-----------------------------------------------------------------------------
+	//    Class:			list_formatter
+	//	  Method:			write(ostream& sout, const C& x)
+	//
+	//	  Description:		formats x and writes it to sout in one call. If
+	//						sout has flags or a precision other than the
+	//						defaults (hex, fixed, ...), numbers are printed
+	//						through a stream carrying sout's settings instead
+	//						of to_chars, so they come out as before. A width
+	//						set on sout pads the whole rendering with sout's
+	//						fill, on the side adjustfield asks for, and is
+	//						reset to 0 like any formatted output
+	//
+	//    Calls:            format()
+	//    Called By:		operator<<
+	//
+	//    Parameters:		ostream& sout, const C& x
+	//	  Return:			sout
+	//
+	//    History Log:
+	//                      10/17/2026 RD completed version
+	//                      10/17/2026 RD honors and resets sout.width()
+	//-----------------------------------------------------------------------------
+
+	template <class C>
+	ostream& list_formatter::write(ostream& sout, const C& x)
+	{
+		const ios_base::fmtflags plain = ios_base::dec | ios_base::skipws;
+		m_fast = sout.flags() == plain && sout.precision() == 6;
+		m_stream.flags(sout.flags());
+		m_stream.precision(sout.precision());
+		m_stream.fill(sout.fill());
+		format(x);
+		m_fast = true;
+		m_stream.flags(plain);
+		m_stream.precision(6);
+		m_stream.fill(' ');
+
+		streamsize size = static_cast<streamsize>(m_buffer.size());
+		streamsize pad = sout.width() > size ? sout.width() - size : 0;
+		sout.width(0);
+		bool left = (sout.flags() & ios_base::adjustfield) == ios_base::left;
+		if (pad != 0 && !left)
+			sout << string(static_cast<size_t>(pad), sout.fill());
+		sout.write(m_buffer.data(), size);
+		if (pad != 0 && left)
+			sout << string(static_cast<size_t>(pad), sout.fill());
+		return sout;
+	}
+
+	//-----------------------------------------------------------------------------
+	//    Class:			list_formatter
+	//	  Method:			append(const T& x)
+	//
+	//	  Description:		renders one element onto the buffer
+	//
+	//    Calls:            to_chars(), append_streamed() for other T
+	//    Called By:		format()
+	//
+	//    Parameters:		const T& x
+	//
+	//    History Log:
+	//                      10/17/2026 RD completed version
+	//-----------------------------------------------------------------------------
+
+	template <class T>
+	void list_formatter::append(const T& x)
+	{
+		if constexpr (is_same<T, char>::value || is_same<T, signed char>::value || is_same<T, unsigned char>::value)
+			m_buffer += static_cast<char>(x);
+		else if constexpr (is_same<T, bool>::value)
+		{
+			if (!m_fast)
+				return append_streamed(x); // boolalpha
+			m_buffer += x ? '1' : '0';
+		}
+		else if constexpr (is_integral<T>::value)
+		{
+			if (!m_fast)
+				return append_streamed(x);
+			char digits[24];
+			to_chars_result r = to_chars(digits, digits + sizeof(digits), x);
+			m_buffer.append(digits, r.ptr);
+		}
+		else if constexpr (is_floating_point<T>::value)
+		{
+			if (!m_fast)
+				return append_streamed(x);
+			char digits[64];
+			to_chars_result r = to_chars(digits, digits + sizeof(digits), x, chars_format::general, 6);
+			m_buffer.append(digits, r.ptr);
+		}
+		else if constexpr (is_convertible<const T&, const string&>::value || is_same<typename decay<T>::type, const char*>::value)
+			m_buffer += x;
+		else
+			append_streamed(x);
+	}
+
+	template <class T>
+	void list_formatter::append_streamed(const T& x)
+	{
+		m_stream.str(string());
+		m_stream.clear();
+		m_stream << x;
+		m_buffer += m_stream.str();
+	}
+}
+
+#endif
@@ -0,0 +1,269 @@
+//-----------------------------------------------------------------------------
+//   File: HazardPointer.h
+//-----------------------------------------------------------------------------
+
+//-----------------------------------------------------------------------------
+//   Title: hazard_domain Class
+//   Description: This file contains the hazard pointer scheme used to free
+//                nodes of the lock-free containers safely
+//
+//   Programmer: Reinaldo Daniswara
+//
+//   Date: 10/17/2026
+//   Version: 1.0
+//
+//   Environment: Intel Core i7
+//     Software: MS Windows 10 for execution;
+//     Compiles under Microsoft Visual Studio 2015
+//
+//   class hazard_domain:
+//
+//     Each thread owns a record of slots_per_thread hazard slots. A thread
+//     publishes a node in a slot before touching it; retired nodes are only
+//     freed once no slot holds them. Retired nodes wait in a per-thread list
+//     that is scanned every scan_threshold retirements. When a thread exits,
+//     its record is given back and any nodes still protected elsewhere are
+//     parked in a shared orphan list that the next scan adopts.
+//
+//     Methods:
+//
+//       static inline:
+//         void set(unsigned i, void* p) -- publish p in slot i
+//         void clear(unsigned i) -- empty slot i
+//         N* protect(unsigned i, const atomic<N*>& src) -- publish and
+//                                                          re-validate src
+//         void retire(N* p) -- free p with delete once unprotected
+//
+//       static non-inline:
+//         void retire(void* p, void (*deleter)(void*))
+//         void scan(owner& self) -- frees every retired node no slot holds
+//
+//   History Log:
+//			10/17/2026 RD completed version 1.0
+//-----------------------------------------------------------------------------
+
+#ifndef HAZARD_POINTER_H
+#define HAZARD_POINTER_H
+#include <algorithm>
+#include <atomic>
+#include <mutex>
+#include <stdexcept>
+#include <vector>
+
+using namespace std;
+
+namespace RD_ADT
+{
+
+	class hazard_domain
+	{
+	public:
+		static const unsigned max_threads = 256;
+		static const unsigned slots_per_thread = 2;
+		static const size_t scan_threshold = 2 * max_threads * slots_per_thread;
+
+		static void set(unsigned i, void* p) { self().rec->slot[i].store(p); }
+		static void clear(unsigned i) { self().rec->slot[i].store(nullptr, memory_order_release); }
+
+		template <class N>
+		static N* protect(unsigned i, const atomic<N*>& src)
+		{
+			atomic<void*>& slot = self().rec->slot[i];
+			N* p = src.load();
+			for (;;)
+			{
+				slot.store(p);
+				N* q = src.load();
+				if (q == p)
+					return p;
+				p = q;
+			}
+		}
+
+		template <class N>
+		static void retire(N* p) { retire(p, &destroy<N>); }
+		static void retire(void* p, void (*deleter)(void*));
+
+	private:
+		struct record
+		{
+			atomic<bool> active;
+			atomic<void*> slot[slots_per_thread];
+		};
+		struct retired
+		{
+			void* ptr;
+			void (*deleter)(void*);
+		};
+		struct shared_state
+		{
+			record records[max_threads];
+			mutex lock; // guards orphans
+			vector<retired> orphans;
+		};
+		// per-thread record and retired list
+		struct owner
+		{
+			record* rec;
+			vector<retired> pending;
+			owner();
+			~owner();
+		};
+
+		template <class N>
+		static void destroy(void* p) { delete static_cast<N*>(p); }
+
+		static shared_state& shared()
+		{
+			static shared_state* s = new shared_state(); // never destroyed, outlives every thread
+			return *s;
+		}
+		static owner& self()
+		{
+			thread_local owner o;
+			return o;
+		}
+		static void scan(owner& o);
+	};
+
+	//-----------------------------------------------------------------------------
+	//    Class:			hazard_domain::owner
+	//	  Method:			owner()
+	//
+	//	  Description:		claims a free record for the calling thread
+	//
+	//    Calls:            shared()
+	//    Called By:		self(), once per thread
+	//
+	//    Parameters:		none
+	//
+	//    History Log:
+	//                      10/17/2026 RD completed version
+	//-----------------------------------------------------------------------------
+
+	inline hazard_domain::owner::owner() : rec(nullptr)
+	{
+		shared_state& s = shared();
+		for (unsigned i = 0; i < max_threads; i++)
+		{
+			bool expected = false;
+			if (!s.records[i].active.load(memory_order_relaxed)
+				&& s.records[i].active.compare_exchange_strong(expected, true))
+			{
+				rec = &s.records[i];
+				return;
+			}
+		}
+		throw runtime_error("too many threads using hazard pointers");
+	}
+
+	//-----------------------------------------------------------------------------
+	//    Class:			hazard_domain::owner
+	//	  Method:			~owner()
+	//
+	//	  Description:		frees what it can, parks the rest with the orphans
+	//						and gives the record back
+	//
+	//    Calls:            scan()
+	//    Called By:		thread exit
+	//
+	//    Parameters:		none
+	//
+	//    History Log:
+	//                      10/17/2026 RD completed version
+	//-----------------------------------------------------------------------------
+
+	inline hazard_domain::owner::~owner()
+	{
+		for (unsigned i = 0; i < slots_per_thread; i++)
+			rec->slot[i].store(nullptr);
+		scan(*this);
+		if (!pending.empty())
+		{
+			shared_state& s = shared();
+			lock_guard<mutex> guard(s.lock);
+			s.orphans.insert(s.orphans.end(), pending.begin(), pending.end());
+		}
+		rec->active.store(false, memory_order_release);
+	}
+
+	//-----------------------------------------------------------------------------
+	//    Class:			hazard_domain
+	//	  Method:			retire(void* p, void (*deleter)(void*))
+	//
+	//	  Description:		queues p to be freed by deleter once unprotected
+	//
+	//    Calls:            scan()
+	//    Called By:		lock-free containers
+	//
+	//    Parameters:		void* p, void (*deleter)(void*)
+	//
+	//    History Log:
+	//                      10/17/2026 RD completed version
+	//-----------------------------------------------------------------------------
+
+	inline void hazard_domain::retire(void* p, void (*deleter)(void*))
+	{
+		owner& o = self();
+		retired r = { p, deleter };
+		o.pending.push_back(r);
+		if (o.pending.size() >= scan_threshold)
+			scan(o);
+	}
+
+	//-----------------------------------------------------------------------------
+	//    Class:			hazard_domain
+	//	  Method:			scan(owner& o)
+	//
+	//	  Description:		adopts any orphans, snapshots every published
+	//						slot and frees each retired node not among them
+	//
+	//    Calls:            shared()
+	//    Called By:		retire(), ~owner()
+	//
+	//    Parameters:		owner& o
+	//
+	//    History Log:
+	//                      10/17/2026 RD completed version
+	//-----------------------------------------------------------------------------
+
+	inline void hazard_domain::scan(owner& o)
+	{
+		shared_state& s = shared();
+		{
+			lock_guard<mutex> guard(s.lock);
+			if (!s.orphans.empty())
+			{
+				o.pending.insert(o.pending.end(), s.orphans.begin(), s.orphans.end());
+				s.orphans.clear();
+			}
+		}
+
+		vector<void*> hazards;
+		hazards.reserve(max_threads * slots_per_thread);
+		for (unsigned i = 0; i < max_threads; i++)
+		{
+			if (!s.records[i].active.load())
+				continue;
+			for (unsigned j = 0; j < slots_per_thread; j++)
+			{
+				void* p = s.records[i].slot[j].load();
+				if (p != nullptr)
+					hazards.push_back(p);
+			}
+		}
+		sort(hazards.begin(), hazards.end());
+
+		size_t kept = 0;
+		for (size_t i = 0; i < o.pending.size(); i++)
+		{
+			if (binary_search(hazards.begin(), hazards.end(), o.pending[i].ptr))
+				o.pending[kept++] = o.pending[i];
+			else
+				o.pending[i].deleter(o.pending[i].ptr);
+		}
+		o.pending.resize(kept);
+	}
+}
+
+#endif
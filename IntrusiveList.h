@@ -0,0 +1,594 @@
+//-----------------------------------------------------------------------------
+//   File: IntrusiveList.h
+//-----------------------------------------------------------------------------
+
+//-----------------------------------------------------------------------------
+//   Title: intrusive_list and CIntrusiveQueue Classes
+//   Description: This file contains a list whose links live inside the
+//                elements, and the queue built on it
+//
+//   Programmer: Reinaldo Daniswara
+//
+//   Date: 10/17/2026
+//   Version: 1.0
+//
+//   Environment: Intel Core i7
+//     Software: MS Windows 10 for execution;
+//     Compiles under Microsoft Visual Studio 2015
+//
+//   struct list_hook<T>:
+//
+//     The links an element needs to sit in an intrusive_list, embedded in
+//     T as a member. An unlinked hook has null links; a linked one always
+//     has a prev link, the head's pointing back at the tail, so an element
+//     can tell whether it is on a list. A hook belongs to at most one list at a time;
+//     give T one hook per list it must be on at once.
+//
+//   class intrusive_list<T, Hook>:
+//
+//     Template Parameters:
+//       T -- element type
+//       Hook -- pointer to the list_hook<T> member to link through, as in
+//               intrusive_list<task, &task::hook>
+//
+//     Same head/tail discipline as list, but the list owns no
+//     cells: it links the caller's objects through their hooks, so it never
+//     allocates, never copies an element and never destroys one. The
+//     caller keeps each element alive while it is linked; destroying the
+//     list only unlinks them. Since the links are in the element, unlinking
+//     it from anywhere is O(1) without an iterator.
+//
+//     Properties:
+//       T *head -- front end of list
+//       T *tail -- back end of list
+//       unsigned m_size -- number of elements in the list
+//
+//     Methods:
+//
+//       inline:
+//         intrusive_list() -- construct the empty list
+//         intrusive_list(intrusive_list&& x) -- takes over the elements of x
+//         ~intrusive_list() { release(); } -- unlinks every element
+//         unsigned getSize()const, size_t size()const -- m_size
+//         bool empty()const -- true if no elements
+//         T& front()const, T& back()const -- first and last element
+//         begin(), end(), cbegin(), cend(), rbegin(), rend() -- as for list
+//         iterator iterator_to(T& x) -- iterator at an element of this list
+//         static bool is_linked(const T& x) -- true if x is on some list
+//         void push_front(T& x), push_back(T& x) -- link x at one end
+//         void append(intrusive_list&& x) -- moves all of x to the back in O(1)
+//
+//       non-inline:
+//         intrusive_list& operator=(intrusive_list&& x) -- unlinks, then takes over x
+//         T& pop_front(), T& pop_back() -- unlink and return an end element;
+//                  throw runtime_error for an empty list
+//         void insert(const_iterator pos, T& x) -- links x in front of pos
+//         iterator erase(T& x) -- unlinks x, returns the element after it
+//         iterator erase(const_iterator it) -- same, at an iterator
+//         void release() -- unlinks every element
+//         void swap(intrusive_list& x) -- exchanges contents in O(1)
+//         void link(T* pos, T& x) -- private, links x in front of pos
+//
+//     class basic_iterator<Const> -- bidirectional iterator with a null
+//                  end(), like list's; ++ follows the element's next link,
+//                  null only at the tail, so an iterator survives swap,
+//                  moves and append and ends at the end() of the list now
+//                  holding its element
+//
+//   class CIntrusiveQueue<T, Hook>:
+//
+//     CQueue over intrusive_list: push links the caller's object at the
+//     back, pop unlinks the front one and returns it by reference.
+//
+//     Methods:
+//
+//       inline:
+//         unsigned getSize()const, bool empty()const
+//         begin(), end(), cbegin(), cend()
+//         void push(T& x) -- links x at the back
+//         T& pop() -- unlinks the front element
+//         void push_bulk(intrusive_list&& batch) -- links the batch onto the back in O(1)
+//         void erase(T& x) -- unlinks x from the middle in O(1)
+//         void release() -- unlinks every element
+//
+//   History Log:
+//			10/17/2026 RD completed version 1.0
+//			10/17/2026 RD tail's next link is null, iterators survive swap and append
+//-----------------------------------------------------------------------------
+
+#ifndef INTRUSIVE_LIST_H
+#define INTRUSIVE_LIST_H
+#include <cstddef>
+#include <iostream>
+#include <iterator>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include "Format.h"
+
+using namespace std;
+
+namespace RD_ADT
+{
+
+	template <class T>
+	struct list_hook
+	{
+		list_hook() : next(nullptr), prev(nullptr) {}
+		list_hook(const list_hook&) : next(nullptr), prev(nullptr) {} // a copy is not on the list
+		list_hook& operator=(const list_hook&) { return *this; }
+
+		T *next; // forward link, nullptr at the tail and while unlinked
+		T *prev; // backward link, the head's is the tail, nullptr while unlinked
+	};
+
+	template <class T, list_hook<T> T::*Hook>
+	class intrusive_list
+	{
+	public:
+		template <bool Const> class basic_iterator;
+		typedef basic_iterator<false> iterator;
+		typedef basic_iterator<true> const_iterator;
+		typedef std::reverse_iterator<iterator> reverse_iterator;
+		typedef std::reverse_iterator<const_iterator> const_reverse_iterator;
+		typedef T value_type;
+		typedef T& reference;
+		typedef const T& const_reference;
+		typedef size_t size_type;
+		typedef ptrdiff_t difference_type;
+
+		intrusive_list() : head(nullptr), tail(nullptr), m_size(0) {}
+		intrusive_list(const intrusive_list&) = delete;
+		intrusive_list& operator=(const intrusive_list&) = delete;
+		intrusive_list(intrusive_list&& x) : head(x.head), tail(x.tail), m_size(x.m_size)
+		{
+			x.head = x.tail = nullptr;
+			x.m_size = 0;
+		}
+		intrusive_list& operator=(intrusive_list&& x);
+		~intrusive_list() { release(); }
+
+		unsigned getSize() const { return m_size; }
+		size_t size() const { return m_size; }
+		bool empty() const { return head == nullptr; }
+		T& front() const { return *head; }
+		T& back() const { return *tail; }
+		iterator begin() { return iterator(head, this); }
+		const_iterator begin() const { return const_iterator(head, this); }
+		iterator end() { return iterator(nullptr, this); }
+		const_iterator end() const { return const_iterator(nullptr, this); }
+		const_iterator cbegin() const { return begin(); }
+		const_iterator cend() const { return end(); }
+		reverse_iterator rbegin() { return reverse_iterator(end()); }
+		const_reverse_iterator rbegin() const { return const_reverse_iterator(end()); }
+		reverse_iterator rend() { return reverse_iterator(begin()); }
+		const_reverse_iterator rend() const { return const_reverse_iterator(begin()); }
+		iterator iterator_to(T& x) { return iterator(&x, this); }
+		static bool is_linked(const T& x) { return (x.*Hook).prev != nullptr; }
+
+		void push_front(T& x)
+		{
+			link(head, x);
+			head = &x;
+		}
+		void push_back(T& x) { link(nullptr, x); }
+		T& pop_front();
+		T& pop_back();
+		void insert(const_iterator pos, T& x);
+		iterator erase(T& x);
+		iterator erase(const_iterator it);
+		void release();
+		void swap(intrusive_list& x);
+		void append(intrusive_list&& x);
+
+	private:
+		static list_hook<T>& hook(T* x) { return x->*Hook; }
+
+		void link(T* pos, T& x);
+
+		T *head;
+		T *tail;
+		unsigned m_size; // number of elements in the list
+	public:
+		// scoped within class intrusive_list ! Const selects const_iterator
+		template <bool Const>
+		class basic_iterator
+		{
+		public:
+			typedef bidirectional_iterator_tag iterator_category;
+			typedef T value_type;
+			typedef ptrdiff_t difference_type;
+			typedef typename conditional<Const, const T*, T*>::type pointer;
+			typedef typename conditional<Const, const T&, T&>::type reference;
+
+			basic_iterator() : ptr(nullptr), owner(nullptr) {}
+			basic_iterator(T* p, const intrusive_list* o) : ptr(p), owner(o) {}
+			operator basic_iterator<true>() const { return basic_iterator<true>(ptr, owner); }
+			basic_iterator& operator++()
+			{
+				if (ptr == nullptr)
+					throw runtime_error("nullptr pointer");
+				ptr = hook(ptr).next;
+				return *this;
+			}
+			basic_iterator& operator--()
+			{
+				if (ptr == nullptr)
+				{
+					if (owner == nullptr || owner->tail == nullptr)
+						throw runtime_error("nullptr pointer");
+					ptr = owner->tail;
+				}
+				else
+					ptr = hook(ptr).prev;
+				return *this;
+			}
+			basic_iterator operator++(int) { basic_iterator old(*this); ++*this; return old; }
+			basic_iterator operator--(int) { basic_iterator old(*this); --*this; return old; }
+			pointer operator->() const { return ptr; }
+			reference operator*() const { return *ptr; }
+			T* node() const { return ptr; }
+			friend bool operator==(const basic_iterator& a, const basic_iterator& b) { return a.ptr == b.ptr; }
+			friend bool operator!=(const basic_iterator& a, const basic_iterator& b) { return a.ptr != b.ptr; }
+		private:
+			T* ptr; // current element, nullptr once past the tail
+			const intrusive_list* owner; // list walked, to step off the tail and back from end()
+		};
+	};
+
+	template <class T, list_hook<T> T::*Hook>
+	ostream& operator<<(ostream& sout, const intrusive_list<T, Hook>& x)
+	{
+		return print_list(sout, x);
+	}
+
+	//-----------------------------------------------------------------------------
+	//    Class:			intrusive_list<T, Hook>
+	//	  Method:			link(T* pos, T& x)
+	//
+	//	  Description:		links x in front of pos; pos == nullptr means
+	//						after the tail. head is left alone, callers
+	//						linking in front of it move it themselves
+	//
+	//    Calls:            none
+	//    Called By:		push_front(), push_back(), insert()
+	//
+	//    Parameters:		T* pos, T& x
+	//
+	//    History Log:
+	//                      10/17/2026 RD completed version
+	//-----------------------------------------------------------------------------
+
+	template <class T, list_hook<T> T::*Hook>
+	void intrusive_list<T, Hook>::link(T* pos, T& x)
+	{
+		if (is_linked(x))
+			throw runtime_error("Element already linked");
+		list_hook<T>& h = x.*Hook;
+		if (empty())
+		{
+			h.next = nullptr;
+			h.prev = &x;
+			head = tail = &x;
+		}
+		else if (pos == nullptr)
+		{
+			h.next = nullptr;
+			h.prev = tail;
+			hook(tail).next = &x;
+			hook(head).prev = &x;
+			tail = &x;
+		}
+		else
+		{
+			T* before = hook(pos).prev; // the tail if pos is the head
+			h.next = pos;
+			h.prev = before;
+			hook(pos).prev = &x;
+			if (pos != head)
+				hook(before).next = &x;
+		}
+		m_size++;
+	}
+
+	//-----------------------------------------------------------------------------
+	//    Class:			intrusive_list<T, Hook>
+	//	  Method:			insert(const_iterator pos, T& x)
+	//
+	//	  Description:		links x in front of pos; pos == end() means after
+	//						the tail
+	//
+	//    Calls:            link()
+	//    Called By:		n/a
+	//
+	//    Parameters:		const_iterator pos, T& x
+	//
+	//    History Log:
+	//                      10/17/2026 RD completed version
+	//-----------------------------------------------------------------------------
+
+	template <class T, list_hook<T> T::*Hook>
+	void intrusive_list<T, Hook>::insert(const_iterator pos, T& x)
+	{
+		T* p = const_cast<T*>(pos.node());
+		link(p, x);
+		if (p != nullptr && p == head)
+			head = &x;
+	}
+
+	//-----------------------------------------------------------------------------
+	//    Class:			intrusive_list<T, Hook>
+	//	  Method:			erase(T& x)
+	//
+	//	  Description:		unlinks x, which must be on this list, in O(1)
+	//	  Return:			iterator at the element after x, or end()
+	//
+	//    Calls:            none
+	//    Called By:		pop_front(), pop_back(), erase(const_iterator),
+	//						release(), CIntrusiveQueue::erase()
+	//
+	//    Parameters:		T& x
+	//
+	//    History Log:
+	//                      10/17/2026 RD completed version
+	//-----------------------------------------------------------------------------
+
+	template <class T, list_hook<T> T::*Hook>
+	typename intrusive_list<T, Hook>::iterator intrusive_list<T, Hook>::erase(T& x)
+	{
+		if (!is_linked(x))
+			throw runtime_error("nullptr pointer");
+		list_hook<T>& h = x.*Hook;
+		T* after = h.next;
+		if (m_size == 1)
+			head = tail = nullptr;
+		else if (&x == head)
+		{
+			head = h.next;
+			hook(head).prev = tail;
+		}
+		else if (&x == tail)
+		{
+			tail = h.prev;
+			hook(tail).next = nullptr;
+			hook(head).prev = tail;
+		}
+		else
+		{
+			hook(h.prev).next = h.next;
+			hook(h.next).prev = h.prev;
+		}
+		h.next = h.prev = nullptr;
+		m_size--;
+		return iterator(after, this);
+	}
+
+	//-----------------------------------------------------------------------------
+	//    Class:			intrusive_list<T, Hook>
+	//	  Method:			erase(const_iterator it)
+	//
+	//	  Description:		unlinks the element at it
+	//	  Return:			iterator at the next element, or end()
+	//
+	//    Calls:            erase(T&)
+	//    Called By:		n/a
+	//
+	//    Parameters:		const_iterator it
+	//
+	//    History Log:
+	//                      10/17/2026 RD completed version
+	//-----------------------------------------------------------------------------
+
+	template <class T, list_hook<T> T::*Hook>
+	typename intrusive_list<T, Hook>::iterator intrusive_list<T, Hook>::erase(const_iterator it)
+	{
+		if (it.node() == nullptr)
+			throw runtime_error("nullptr pointer");
+		return erase(*const_cast<T*>(it.node()));
+	}
+
+	//-----------------------------------------------------------------------------
+	//    Class:			intrusive_list<T, Hook>
+	//	  Method:			pop_front()
+	//
+	//	  Description:		unlinks the front element
+	//	  Return:			the element, still owned by the caller
+	//
+	//    Calls:            erase()
+	//    Called By:		CIntrusiveQueue::pop()
+	//
+	//    Parameters:		none
+	//
+	//    History Log:
+	//                      10/17/2026 RD completed version
+	//-----------------------------------------------------------------------------
+
+	template <class T, list_hook<T> T::*Hook>
+	T& intrusive_list<T, Hook>::pop_front()
+	{
+		if (head == nullptr)
+			throw runtime_error("Empty list");
+		T& x = *head;
+		erase(x);
+		return x;
+	}
+
+	//-----------------------------------------------------------------------------
+	//    Class:			intrusive_list<T, Hook>
+	//	  Method:			pop_back()
+	//
+	//	  Description:		unlinks the back element
+	//	  Return:			the element, still owned by the caller
+	//
+	//    Calls:            erase()
+	//    Called By:		n/a
+	//
+	//    Parameters:		none
+	//
+	//    History Log:
+	//                      10/17/2026 RD completed version
+	//-----------------------------------------------------------------------------
+
+	template <class T, list_hook<T> T::*Hook>
+	T& intrusive_list<T, Hook>::pop_back()
+	{
+		if (tail == nullptr)
+			throw runtime_error("Empty list");
+		T& x = *tail;
+		erase(x);
+		return x;
+	}
+
+	//-----------------------------------------------------------------------------
+	//    Class:			intrusive_list<T, Hook>
+	//	  Method:			release()
+	//
+	//	  Description:		unlinks every element, leaving their hooks null;
+	//						no element is destroyed
+	//
+	//    Calls:            none
+	//    Called By:		~intrusive_list(), operator=(intrusive_list&&)
+	//
+	//    Parameters:		none
+	//
+	//    History Log:
+	//                      10/17/2026 RD completed version
+	//-----------------------------------------------------------------------------
+
+	template <class T, list_hook<T> T::*Hook>
+	void intrusive_list<T, Hook>::release()
+	{
+		T* x = head;
+		for (unsigned i = 0; i < m_size; i++)
+		{
+			list_hook<T>& h = x->*Hook;
+			x = h.next;
+			h.next = h.prev = nullptr;
+		}
+		head = tail = nullptr;
+		m_size = 0;
+	}
+
+	//-----------------------------------------------------------------------------
+	//    Class:			intrusive_list<T, Hook>
+	//	  Method:			operator=(intrusive_list&& x)
+	//
+	//	  Description:		unlinks this list's elements, then takes over
+	//						those of x, leaving x empty
+	//	  Return:			*this
+	//
+	//    Calls:            release(), swap()
+	//    Called By:		n/a
+	//
+	//    Parameters:		intrusive_list&& x
+	//
+	//    History Log:
+	//                      10/17/2026 RD completed version
+	//-----------------------------------------------------------------------------
+
+	template <class T, list_hook<T> T::*Hook>
+	intrusive_list<T, Hook>& intrusive_list<T, Hook>::operator=(intrusive_list&& x)
+	{
+		if (&x != this)
+		{
+			release();
+			swap(x);
+		}
+		return *this;
+	}
+
+	//-----------------------------------------------------------------------------
+	//    Class:			intrusive_list<T, Hook>
+	//	  Method:			swap(intrusive_list& x)
+	//
+	//	  Description:		exchanges the contents of two lists in O(1)
+	//
+	//    Calls:            none
+	//    Called By:		operator=(intrusive_list&&)
+	//
+	//    Parameters:		intrusive_list& x
+	//
+	//    History Log:
+	//                      10/17/2026 RD completed version
+	//-----------------------------------------------------------------------------
+
+	template <class T, list_hook<T> T::*Hook>
+	void intrusive_list<T, Hook>::swap(intrusive_list& x)
+	{
+		std::swap(head, x.head);
+		std::swap(tail, x.tail);
+		std::swap(m_size, x.m_size);
+	}
+
+	//-----------------------------------------------------------------------------
+	//    Class:			intrusive_list<T, Hook>
+	//	  Method:			append(intrusive_list&& x)
+	//
+	//	  Description:		links the whole chain of x onto the back of this
+	//						list with a constant number of pointer updates,
+	//						leaving x empty
+	//
+	//    Calls:            swap()
+	//    Called By:		CIntrusiveQueue::push_bulk()
+	//
+	//    Parameters:		intrusive_list&& x
+	//
+	//    History Log:
+	//                      10/17/2026 RD completed version
+	//-----------------------------------------------------------------------------
+
+	template <class T, list_hook<T> T::*Hook>
+	void intrusive_list<T, Hook>::append(intrusive_list&& x)
+	{
+		if (&x == this || x.empty())
+			return;
+		if (empty())
+		{
+			swap(x);
+			return;
+		}
+		hook(tail).next = x.head;
+		hook(x.head).prev = tail;
+		hook(head).prev = x.tail;
+		tail = x.tail;
+		m_size += x.m_size;
+		x.head = x.tail = nullptr;
+		x.m_size = 0;
+	}
+
+	template <class T, list_hook<T> T::*Hook>
+	class CIntrusiveQueue : protected intrusive_list<T, Hook>
+	{
+		typedef intrusive_list<T, Hook> base;
+	public:
+		typedef typename base::iterator iterator;
+		typedef typename base::const_iterator const_iterator;
+		typedef T value_type;
+
+		CIntrusiveQueue() : base() {}
+		CIntrusiveQueue(base&& other) : base(std::move(other)) {}
+
+		unsigned getSize() const { return base::getSize(); }
+		bool empty() const { return base::empty(); }
+		iterator begin() { return base::begin(); }
+		const_iterator begin() const { return base::begin(); }
+		iterator end() { return base::end(); }
+		const_iterator end() const { return base::end(); }
+		const_iterator cbegin() const { return base::cbegin(); }
+		const_iterator cend() const { return base::cend(); }
+
+		void push(T& x) { base::push_back(x); }
+		T& pop() { return base::pop_front(); }
+		void push_bulk(base&& batch) { base::append(std::move(batch)); }
+		void erase(T& x) { base::erase(x); }
+		void release() { base::release(); }
+	};
+
+	template <class T, list_hook<T> T::*Hook>
+	ostream& operator<<(ostream& sout, const CIntrusiveQueue<T, Hook>& x)
+	{
+		return print_list(sout, x);
+	}
+}
+
+#endif
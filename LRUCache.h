@@ -0,0 +1,228 @@
+//-----------------------------------------------------------------------------
+//   File: LRUCache.h
+//-----------------------------------------------------------------------------
+
+//-----------------------------------------------------------------------------
+//   Title: LRUCache Class
+//   Description: This file contains a fixed capacity least recently used
+//                cache over linked_hash_map
+//
+//   Programmer: Reinaldo Daniswara
+//
+//   Date: 10/17/2026
+//   Version: 1.0
+//
+//   Environment: Intel Core i7
+//     Software: MS Windows 10 for execution;
+//     Compiles under Microsoft Visual Studio 2015
+//
+//   class LRUCache<K, V, Hash, KeyEqual, Alloc>:
+//
+//     Entries are kept most recently used first. A hit relinks the entry at
+//     the front, and inserting into a full cache evicts the back entry, all
+//     in O(1). Like list, a cache is not thread safe.
+//
+//     Properties:
+//       linked_hash_map<K, V, ...> m_entries -- most recently used first
+//       size_t m_capacity -- most entries held
+//       size_t m_hits, m_misses, m_evictions -- counters since construction
+//                                               or reset_counters()
+//
+//     Methods:
+//
+//       inline:
+//         unsigned getSize()const, size_t size()const -- number of entries
+//         size_t capacity()const
+//         bool empty()const, bool contains(const K& key)const
+//         const_iterator begin()const, end()const -- most recently used first
+//         size_t hits()const, misses()const, evictions()const
+//         double hit_rate()const -- hits / lookups, 0 before any lookup
+//         void reset_counters()
+//         void release() -- drops every entry, keeps the counters
+//
+//       non-inline:
+//         LRUCache(size_t capacity) -- throws out_of_range for 0
+//         V* get(const K& key) -- the value, now most recently used, or
+//                  nullptr; counts a hit or a miss. The pointer stays valid
+//                  until the entry is evicted or erased
+//         const V* peek(const K& key)const -- the value without counting or
+//                  reordering, or nullptr
+//         bool put(const K& key, V value) -- stores value as most recently
+//                  used, evicting the least recently used entry if full
+//         bool erase(const K& key) -- false if key was absent
+//
+//   History Log:
+//			10/17/2026 RD completed version 1.0
+//-----------------------------------------------------------------------------
+
+#ifndef LRU_CACHE_H
+#define LRU_CACHE_H
+#include <stdexcept>
+#include <utility>
+#include "LinkedHashMap.h"
+
+using namespace std;
+
+namespace RD_ADT
+{
+
+	template <class K, class V, class Hash = hash<K>, class KeyEqual = equal_to<K>,
+		class Alloc = pool_allocator<pair<const K, V> > >
+	class LRUCache
+	{
+	public:
+		typedef linked_hash_map<K, V, Hash, KeyEqual, Alloc> map_type;
+		typedef typename map_type::const_iterator const_iterator;
+
+		explicit LRUCache(size_t capacity);
+
+		unsigned getSize() const { return m_entries.getSize(); }
+		size_t size() const { return m_entries.size(); }
+		size_t capacity() const { return m_capacity; }
+		bool empty() const { return m_entries.empty(); }
+		bool contains(const K& key) const { return m_entries.contains(key); }
+		const_iterator begin() const { return m_entries.begin(); }
+		const_iterator end() const { return m_entries.end(); }
+		size_t hits() const { return m_hits; }
+		size_t misses() const { return m_misses; }
+		size_t evictions() const { return m_evictions; }
+		double hit_rate() const
+		{
+			size_t lookups = m_hits + m_misses;
+			return lookups == 0 ? 0.0 : static_cast<double>(m_hits) / lookups;
+		}
+		void reset_counters() { m_hits = m_misses = m_evictions = 0; }
+		void release() { m_entries.release(); }
+
+		V* get(const K& key);
+		const V* peek(const K& key) const;
+		bool put(const K& key, V value);
+		bool erase(const K& key) { return m_entries.erase(key); }
+
+	private:
+		map_type m_entries; // most recently used first
+		size_t m_capacity;
+		size_t m_hits;
+		size_t m_misses;
+		size_t m_evictions;
+	};
+
+	//-----------------------------------------------------------------------------
+	//    Class:			LRUCache<K, V>
+	//	  Method:			LRUCache(size_t capacity)
+	//
+	//	  Description:		an empty cache holding up to capacity entries;
+	//						the index is sized for all of them up front
+	//
+	//    Calls:            linked_hash_map::reserve()
+	//    Called By:		main
+	//
+	//    Parameters:		size_t capacity
+	//
+	//    History Log:
+	//                      10/17/2026 RD completed version
+	//-----------------------------------------------------------------------------
+
+	template <class K, class V, class Hash, class KeyEqual, class Alloc>
+	LRUCache<K, V, Hash, KeyEqual, Alloc>::LRUCache(size_t capacity)
+		: m_capacity(capacity), m_hits(0), m_misses(0), m_evictions(0)
+	{
+		if (capacity == 0)
+			throw out_of_range("Zero capacity");
+		m_entries.reserve(capacity);
+	}
+
+	//-----------------------------------------------------------------------------
+	//    Class:			LRUCache<K, V>
+	//	  Method:			get(const K& key)
+	//
+	//	  Description:		looks key up; a hit becomes most recently used
+	//	  Return:			pointer to the value, or nullptr on a miss
+	//
+	//    Calls:            linked_hash_map::find(), move_to_front()
+	//    Called By:		main
+	//
+	//    Parameters:		const K& key
+	//
+	//    History Log:
+	//                      10/17/2026 RD completed version
+	//-----------------------------------------------------------------------------
+
+	template <class K, class V, class Hash, class KeyEqual, class Alloc>
+	V* LRUCache<K, V, Hash, KeyEqual, Alloc>::get(const K& key)
+	{
+		typename map_type::iterator it = m_entries.find(key);
+		if (it == m_entries.end())
+		{
+			m_misses++;
+			return nullptr;
+		}
+		m_hits++;
+		m_entries.move_to_front(it);
+		return &it->second;
+	}
+
+	//-----------------------------------------------------------------------------
+	//    Class:			LRUCache<K, V>
+	//	  Method:			peek(const K& key)const
+	//
+	//	  Description:		looks key up without touching the order or the
+	//						counters
+	//	  Return:			pointer to the value, or nullptr
+	//
+	//    Calls:            linked_hash_map::find()
+	//    Called By:		main
+	//
+	//    Parameters:		const K& key
+	//
+	//    History Log:
+	//                      10/17/2026 RD completed version
+	//-----------------------------------------------------------------------------
+
+	template <class K, class V, class Hash, class KeyEqual, class Alloc>
+	const V* LRUCache<K, V, Hash, KeyEqual, Alloc>::peek(const K& key) const
+	{
+		const_iterator it = m_entries.find(key);
+		return it == m_entries.end() ? nullptr : &it->second;
+	}
+
+	//-----------------------------------------------------------------------------
+	//    Class:			LRUCache<K, V>
+	//	  Method:			put(const K& key, V value)
+	//
+	//	  Description:		stores value under key as most recently used. A
+	//						new key in a full cache first evicts the least
+	//						recently used entry
+	//	  Return:			true if key was not cached before
+	//
+	//    Calls:            linked_hash_map::find(), move_to_front(),
+	//						pop_back(), emplace_front()
+	//    Called By:		main
+	//
+	//    Parameters:		const K& key, V value
+	//
+	//    History Log:
+	//                      10/17/2026 RD completed version
+	//-----------------------------------------------------------------------------
+
+	template <class K, class V, class Hash, class KeyEqual, class Alloc>
+	bool LRUCache<K, V, Hash, KeyEqual, Alloc>::put(const K& key, V value)
+	{
+		typename map_type::iterator it = m_entries.find(key);
+		if (it != m_entries.end())
+		{
+			it->second = std::move(value);
+			m_entries.move_to_front(it);
+			return false;
+		}
+		if (m_entries.size() >= m_capacity)
+		{
+			m_entries.pop_back();
+			m_evictions++;
+		}
+		m_entries.emplace_front(key, std::move(value));
+		return true;
+	}
+}
+
+#endif
@@ -0,0 +1,539 @@
+//-----------------------------------------------------------------------------
+//   File: LinkedHashMap.h
+//-----------------------------------------------------------------------------
+
+//-----------------------------------------------------------------------------
+//   Title: linked_hash_map Class
+//   Description: This file contains a list of key/value pairs with a hash
+//                index on its cells, for O(1) lookup, erase and reordering
+//
+//   Programmer: Reinaldo Daniswara
+//
+//   Date: 10/17/2026
+//   Version: 1.0
+//
+//   Environment: Intel Core i7
+//     Software: MS Windows 10 for execution;
+//     Compiles under Microsoft Visual Studio 2015
+//
+//   class linked_hash_map<K, V, Hash, KeyEqual, Alloc>:
+//
+//     The entries live in a list<pair<const K, V>>, so they keep the list's
+//     listelem cells and its order. The index is an open addressing table
+//     of slots, each holding a cell pointer and the key's hash; it probes
+//     linearly and erases by shifting the following slots back, so there
+//     are no tombstones. The table has a power of two slots and doubles
+//     before it is three quarters full. Cells never move, so iterators and
+//     references stay valid until their own entry is erased.
+//
+//     Template Parameters:
+//       K, V -- key and value types
+//       Hash, KeyEqual -- hash<K> and equal_to<K> by default
+//       Alloc -- allocator policy for the list cells; must be always equal,
+//                since the index keeps pointers to cells across moves
+//
+//     Properties:
+//       list<value_type, Alloc> m_order -- the entries, front to back
+//       vector<slot> m_slots -- the index, empty until the first insert
+//       Hash m_hash, KeyEqual m_equal
+//
+//     Methods:
+//
+//       inline:
+//         linked_hash_map() -- construct the empty map
+//         linked_hash_map(linked_hash_map&& x) -- takes over x's cells and index;
+//                  copying is disabled
+//         unsigned getSize()const, size_t size()const -- number of entries
+//         bool empty()const -- true if no entries
+//         iterator begin(), end() -- front to back, const versions too
+//         value_type& front(), back() -- first and last entry
+//         bool contains(const K& key)const -- true if key is present
+//         void release() -- removes all entries
+//
+//       non-inline:
+//         iterator find(const K& key), const_iterator find(const K& key)const
+//                  -- the entry for key, or end()
+//         pair<iterator, bool> emplace_front(const K& key, Args&&... args),
+//         emplace_back(...) -- inserts key with a value built from args;
+//                  false and the entry found if key is already present
+//         bool erase(const K& key) -- false if key was absent
+//         iterator erase(const_iterator it) -- returns the next entry
+//         bool move_to_front(const K& key), move_to_back(const K& key)
+//         void move_to_front(const_iterator it), move_to_back(const_iterator it)
+//         value_type pop_front(), pop_back() -- removes and returns an end
+//                  entry, throws runtime_error on an empty map
+//         void reserve(size_t n) -- sizes the index for n entries
+//
+//       private:
+//         size_t hash_of(const K& key)const -- Hash, mixed so the low bits vary
+//         size_t probe(size_t h, const K& key)const -- slot of key, or the
+//                  empty slot where it would go
+//         size_t slot_of(listelem* e)const -- slot holding the cell e
+//         void insert_slot(listelem* e, size_t h) -- indexes a cell
+//         void erase_slot(size_t i) -- empties slot i, shifting back
+//         void rehash(size_t slots) -- rebuilds the index
+//
+//   History Log:
+//			10/17/2026 RD completed version 1.0
+//-----------------------------------------------------------------------------
+
+#ifndef LINKED_HASH_MAP_H
+#define LINKED_HASH_MAP_H
+#include <functional>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+#include "list.h"
+
+using namespace std;
+
+namespace RD_ADT
+{
+
+	template <class K, class V, class Hash = hash<K>, class KeyEqual = equal_to<K>,
+		class Alloc = pool_allocator<pair<const K, V> > >
+	class linked_hash_map
+	{
+	public:
+		typedef K key_type;
+		typedef V mapped_type;
+		typedef pair<const K, V> value_type;
+		typedef list<value_type, Alloc> list_type;
+		typedef typename list_type::iterator iterator;
+		typedef typename list_type::const_iterator const_iterator;
+		static_assert(allocator_traits<Alloc>::is_always_equal::value, "the index points at cells, Alloc must be always equal");
+
+		linked_hash_map() : m_slots() {}
+		linked_hash_map(const linked_hash_map&) = delete;
+		linked_hash_map& operator=(const linked_hash_map&) = delete;
+		linked_hash_map(linked_hash_map&&) = default; // the cells move with the list
+
+		unsigned getSize() const { return m_order.getSize(); }
+		size_t size() const { return m_order.size(); }
+		bool empty() const { return m_order.empty(); }
+		iterator begin() { return m_order.begin(); }
+		const_iterator begin() const { return m_order.begin(); }
+		iterator end() { return m_order.end(); }
+		const_iterator end() const { return m_order.end(); }
+		value_type& front() { return m_order.front(); }
+		value_type& back() { return m_order.back(); }
+		bool contains(const K& key) const { return find(key) != end(); }
+		void release()
+		{
+			m_order.release();
+			m_slots.clear();
+		}
+
+		iterator find(const K& key);
+		const_iterator find(const K& key) const;
+		template <class... Args>
+		pair<iterator, bool> emplace_front(const K& key, Args&&... args);
+		template <class... Args>
+		pair<iterator, bool> emplace_back(const K& key, Args&&... args);
+		bool erase(const K& key);
+		iterator erase(const_iterator it);
+		bool move_to_front(const K& key);
+		bool move_to_back(const K& key);
+		void move_to_front(const_iterator it) { m_order.splice(m_order.begin(), m_order, it); }
+		void move_to_back(const_iterator it) { m_order.splice(m_order.end(), m_order, it); }
+		value_type pop_front();
+		value_type pop_back();
+		void reserve(size_t n);
+
+	private:
+		typedef typename list_type::listelem listelem;
+		struct slot
+		{
+			listelem* node; // nullptr when empty
+			size_t hash;
+		};
+
+		size_t mask() const { return m_slots.size() - 1; }
+		// spreads hash<K>, which is the identity for integers, over the low bits
+		size_t hash_of(const K& key) const
+		{
+			unsigned long long h = m_hash(key) * 0x9E3779B97F4A7C15ull;
+			return static_cast<size_t>(h ^ (h >> 32));
+		}
+		size_t probe(size_t h, const K& key) const;
+		size_t slot_of(listelem* e) const;
+		void insert_slot(listelem* e, size_t h);
+		void erase_slot(size_t i);
+		void rehash(size_t slots);
+
+		list_type m_order; // entries, front to back
+		vector<slot> m_slots; // index, a power of two slots
+		Hash m_hash;
+		KeyEqual m_equal;
+	};
+
+	//-----------------------------------------------------------------------------
+	//    Class:			linked_hash_map<K, V>
+	//	  Method:			probe(size_t h, const K& key)const
+	//
+	//	  Description:		walks from key's home slot until it finds key or
+	//						an empty slot; the table is never full
+	//	  Return:			slot index
+	//
+	//    Calls:            none
+	//    Called By:		find(), emplace_*(), erase()
+	//
+	//    Parameters:		size_t h -- hash_of(key), const K& key
+	//
+	//    History Log:
+	//                      10/17/2026 RD completed version
+	//-----------------------------------------------------------------------------
+
+	template <class K, class V, class Hash, class KeyEqual, class Alloc>
+	size_t linked_hash_map<K, V, Hash, KeyEqual, Alloc>::probe(size_t h, const K& key) const
+	{
+		size_t i = h & mask();
+		while (m_slots[i].node != nullptr
+			&& !(m_slots[i].hash == h && m_equal(m_slots[i].node->data.first, key)))
+			i = (i + 1) & mask();
+		return i;
+	}
+
+	//-----------------------------------------------------------------------------
+	//    Class:			linked_hash_map<K, V>
+	//	  Method:			slot_of(listelem* e)const
+	//
+	//	  Description:		the slot indexing cell e, matched by pointer
+	//	  Return:			slot index
+	//
+	//    Calls:            none
+	//    Called By:		erase(const_iterator), pop_front(), pop_back()
+	//
+	//    Parameters:		listelem* e -- a cell of m_order
+	//
+	//    History Log:
+	//                      10/17/2026 RD completed version
+	//-----------------------------------------------------------------------------
+
+	template <class K, class V, class Hash, class KeyEqual, class Alloc>
+	size_t linked_hash_map<K, V, Hash, KeyEqual, Alloc>::slot_of(listelem* e) const
+	{
+		size_t i = hash_of(e->data.first) & mask();
+		while (m_slots[i].node != e)
+			i = (i + 1) & mask();
+		return i;
+	}
+
+	//-----------------------------------------------------------------------------
+	//    Class:			linked_hash_map<K, V>
+	//	  Method:			insert_slot(listelem* e, size_t h)
+	//
+	//	  Description:		indexes cell e, whose key is not present, in the
+	//						first empty slot from its home
+	//
+	//    Calls:            none
+	//    Called By:		rehash()
+	//
+	//    Parameters:		listelem* e, size_t h -- hash of e's key
+	//
+	//    History Log:
+	//                      10/17/2026 RD completed version
+	//-----------------------------------------------------------------------------
+
+	template <class K, class V, class Hash, class KeyEqual, class Alloc>
+	void linked_hash_map<K, V, Hash, KeyEqual, Alloc>::insert_slot(listelem* e, size_t h)
+	{
+		size_t i = h & mask();
+		while (m_slots[i].node != nullptr)
+			i = (i + 1) & mask();
+		m_slots[i].node = e;
+		m_slots[i].hash = h;
+	}
+
+	//-----------------------------------------------------------------------------
+	//    Class:			linked_hash_map<K, V>
+	//	  Method:			erase_slot(size_t i)
+	//
+	//	  Description:		empties slot i; each following slot up to the
+	//						next empty one moves back into the hole if its
+	//						home is not between the hole and itself, so every
+	//						key stays reachable from its home
+	//
+	//    Calls:            none
+	//    Called By:		erase(), pop_front(), pop_back()
+	//
+	//    Parameters:		size_t i
+	//
+	//    History Log:
+	//                      10/17/2026 RD completed version
+	//-----------------------------------------------------------------------------
+
+	template <class K, class V, class Hash, class KeyEqual, class Alloc>
+	void linked_hash_map<K, V, Hash, KeyEqual, Alloc>::erase_slot(size_t i)
+	{
+		size_t j = i;
+		for (;;)
+		{
+			j = (j + 1) & mask();
+			if (m_slots[j].node == nullptr)
+				break;
+			size_t home = m_slots[j].hash & mask();
+			if (((j - home) & mask()) >= ((j - i) & mask()))
+			{
+				m_slots[i] = m_slots[j];
+				i = j;
+			}
+		}
+		m_slots[i].node = nullptr;
+	}
+
+	//-----------------------------------------------------------------------------
+	//    Class:			linked_hash_map<K, V>
+	//	  Method:			rehash(size_t slots)
+	//
+	//	  Description:		rebuilds the index with slots entries, a power of
+	//						two, from the stored hashes
+	//
+	//    Calls:            insert_slot()
+	//    Called By:		reserve(), emplace_*()
+	//
+	//    Parameters:		size_t slots
+	//
+	//    History Log:
+	//                      10/17/2026 RD completed version
+	//-----------------------------------------------------------------------------
+
+	template <class K, class V, class Hash, class KeyEqual, class Alloc>
+	void linked_hash_map<K, V, Hash, KeyEqual, Alloc>::rehash(size_t slots)
+	{
+		vector<slot> old(slots, slot{ nullptr, 0 });
+		old.swap(m_slots);
+		for (const slot& s : old)
+			if (s.node != nullptr)
+				insert_slot(s.node, s.hash);
+	}
+
+	//-----------------------------------------------------------------------------
+	//    Class:			linked_hash_map<K, V>
+	//	  Method:			reserve(size_t n)
+	//
+	//	  Description:		grows the index so n entries keep it under three
+	//						quarters full
+	//
+	//    Calls:            rehash()
+	//    Called By:		LRUCache(), n/a
+	//
+	//    Parameters:		size_t n
+	//
+	//    History Log:
+	//                      10/17/2026 RD completed version
+	//-----------------------------------------------------------------------------
+
+	template <class K, class V, class Hash, class KeyEqual, class Alloc>
+	void linked_hash_map<K, V, Hash, KeyEqual, Alloc>::reserve(size_t n)
+	{
+		size_t slots = 8;
+		while (slots / 4 * 3 <= n)
+			slots *= 2;
+		if (slots > m_slots.size())
+			rehash(slots);
+	}
+
+	//-----------------------------------------------------------------------------
+	//    Class:			linked_hash_map<K, V>
+	//	  Method:			find(const K& key)
+	//
+	//	  Description:		looks key up in the index
+	//	  Return:			iterator to the entry, or end()
+	//
+	//    Calls:            probe()
+	//    Called By:		contains(), LRUCache
+	//
+	//    Parameters:		const K& key
+	//
+	//    History Log:
+	//                      10/17/2026 RD completed version
+	//-----------------------------------------------------------------------------
+
+	template <class K, class V, class Hash, class KeyEqual, class Alloc>
+	typename linked_hash_map<K, V, Hash, KeyEqual, Alloc>::iterator linked_hash_map<K, V, Hash, KeyEqual, Alloc>::find(const K& key)
+	{
+		if (m_slots.empty())
+			return end();
+		return iterator(m_slots[probe(hash_of(key), key)].node, &m_order);
+	}
+
+	template <class K, class V, class Hash, class KeyEqual, class Alloc>
+	typename linked_hash_map<K, V, Hash, KeyEqual, Alloc>::const_iterator linked_hash_map<K, V, Hash, KeyEqual, Alloc>::find(const K& key) const
+	{
+		if (m_slots.empty())
+			return end();
+		return const_iterator(m_slots[probe(hash_of(key), key)].node, &m_order);
+	}
+
+	//-----------------------------------------------------------------------------
+	//    Class:			linked_hash_map<K, V>
+	//	  Method:			emplace_front(const K& key, Args&&... args)
+	//						emplace_back(const K& key, Args&&... args)
+	//
+	//	  Description:		adds key at one end with a value built from args,
+	//						unless key is already present
+	//	  Return:			the entry for key, and true if it was added
+	//
+	//    Calls:            reserve() when the index would pass three quarters
+	//						full, probe(), list::emplace_front(),
+	//						list::emplace_back()
+	//    Called By:		LRUCache::put()
+	//
+	//    Parameters:		const K& key, Args&&... args
+	//
+	//    History Log:
+	//                      10/17/2026 RD completed version
+	//-----------------------------------------------------------------------------
+
+	template <class K, class V, class Hash, class KeyEqual, class Alloc>
+	template <class... Args>
+	pair<typename linked_hash_map<K, V, Hash, KeyEqual, Alloc>::iterator, bool>
+		linked_hash_map<K, V, Hash, KeyEqual, Alloc>::emplace_front(const K& key, Args&&... args)
+	{
+		if (size() + 1 >= m_slots.size() / 4 * 3)
+			reserve(size() + 1);
+		size_t h = hash_of(key);
+		size_t i = probe(h, key);
+		if (m_slots[i].node != nullptr)
+			return make_pair(iterator(m_slots[i].node, &m_order), false);
+		m_order.emplace_front(piecewise_construct, forward_as_tuple(key), forward_as_tuple(std::forward<Args>(args)...));
+		m_slots[i].node = m_order.begin().node();
+		m_slots[i].hash = h;
+		return make_pair(m_order.begin(), true);
+	}
+
+	template <class K, class V, class Hash, class KeyEqual, class Alloc>
+	template <class... Args>
+	pair<typename linked_hash_map<K, V, Hash, KeyEqual, Alloc>::iterator, bool>
+		linked_hash_map<K, V, Hash, KeyEqual, Alloc>::emplace_back(const K& key, Args&&... args)
+	{
+		if (size() + 1 >= m_slots.size() / 4 * 3)
+			reserve(size() + 1);
+		size_t h = hash_of(key);
+		size_t i = probe(h, key);
+		if (m_slots[i].node != nullptr)
+			return make_pair(iterator(m_slots[i].node, &m_order), false);
+		m_order.emplace_back(piecewise_construct, forward_as_tuple(key), forward_as_tuple(std::forward<Args>(args)...));
+		iterator last = --m_order.end();
+		m_slots[i].node = last.node();
+		m_slots[i].hash = h;
+		return make_pair(last, true);
+	}
+
+	//-----------------------------------------------------------------------------
+	//    Class:			linked_hash_map<K, V>
+	//	  Method:			erase(const K& key)
+	//						erase(const_iterator it)
+	//
+	//	  Description:		removes an entry from the index and the list
+	//	  Return:			false if key was absent / the entry after it
+	//
+	//    Calls:            probe(), slot_of(), erase_slot(), list::erase()
+	//    Called By:		LRUCache::erase()
+	//
+	//    Parameters:		const K& key / const_iterator it
+	//
+	//    History Log:
+	//                      10/17/2026 RD completed version
+	//-----------------------------------------------------------------------------
+
+	template <class K, class V, class Hash, class KeyEqual, class Alloc>
+	bool linked_hash_map<K, V, Hash, KeyEqual, Alloc>::erase(const K& key)
+	{
+		if (m_slots.empty())
+			return false;
+		size_t i = probe(hash_of(key), key);
+		listelem* e = m_slots[i].node;
+		if (e == nullptr)
+			return false;
+		erase_slot(i);
+		m_order.erase(const_iterator(e, &m_order));
+		return true;
+	}
+
+	template <class K, class V, class Hash, class KeyEqual, class Alloc>
+	typename linked_hash_map<K, V, Hash, KeyEqual, Alloc>::iterator linked_hash_map<K, V, Hash, KeyEqual, Alloc>::erase(const_iterator it)
+	{
+		if (it.node() == nullptr)
+			throw runtime_error("nullptr pointer");
+		erase_slot(slot_of(it.node()));
+		return m_order.erase(it);
+	}
+
+	//-----------------------------------------------------------------------------
+	//    Class:			linked_hash_map<K, V>
+	//	  Method:			move_to_front(const K& key)
+	//						move_to_back(const K& key)
+	//
+	//	  Description:		relinks key's cell at one end in O(1)
+	//	  Return:			false if key is absent
+	//
+	//    Calls:            find(), list::splice()
+	//    Called By:		LRUCache::get(), LRUCache::put()
+	//
+	//    Parameters:		const K& key
+	//
+	//    History Log:
+	//                      10/17/2026 RD completed version
+	//-----------------------------------------------------------------------------
+
+	template <class K, class V, class Hash, class KeyEqual, class Alloc>
+	bool linked_hash_map<K, V, Hash, KeyEqual, Alloc>::move_to_front(const K& key)
+	{
+		iterator it = find(key);
+		if (it == end())
+			return false;
+		move_to_front(it);
+		return true;
+	}
+
+	template <class K, class V, class Hash, class KeyEqual, class Alloc>
+	bool linked_hash_map<K, V, Hash, KeyEqual, Alloc>::move_to_back(const K& key)
+	{
+		iterator it = find(key);
+		if (it == end())
+			return false;
+		move_to_back(it);
+		return true;
+	}
+
+	//-----------------------------------------------------------------------------
+	//    Class:			linked_hash_map<K, V>
+	//	  Method:			pop_front()
+	//						pop_back()
+	//
+	//	  Description:		removes the entry at one end; pop_back() is the
+	//						eviction of an LRU cache
+	//	  Return:			the entry, moved out
+	//
+	//    Calls:            slot_of(), erase_slot(), list::pop_front(),
+	//						list::pop_back()
+	//    Called By:		LRUCache::put()
+	//
+	//    Parameters:		none
+	//
+	//    History Log:
+	//                      10/17/2026 RD completed version
+	//-----------------------------------------------------------------------------
+
+	template <class K, class V, class Hash, class KeyEqual, class Alloc>
+	typename linked_hash_map<K, V, Hash, KeyEqual, Alloc>::value_type linked_hash_map<K, V, Hash, KeyEqual, Alloc>::pop_front()
+	{
+		if (empty())
+			throw runtime_error("Empty list");
+		erase_slot(slot_of(m_order.begin().node()));
+		return m_order.pop_front();
+	}
+
+	template <class K, class V, class Hash, class KeyEqual, class Alloc>
+	typename linked_hash_map<K, V, Hash, KeyEqual, Alloc>::value_type linked_hash_map<K, V, Hash, KeyEqual, Alloc>::pop_back()
+	{
+		if (empty())
+			throw runtime_error("Empty list");
+		erase_slot(slot_of((--m_order.end()).node()));
+		return m_order.pop_back();
+	}
+}
+
+#endif
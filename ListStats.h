@@ -0,0 +1,124 @@
+//-----------------------------------------------------------------------------
+//   File: ListStats.h
+//-----------------------------------------------------------------------------
+
+//-----------------------------------------------------------------------------
+//   Title: no_stats and list_counters Classes
+//   Description: This file contains the instrumentation policies for list
+//                and CQueue
+//
+//   Programmer: Reinaldo Daniswara
+//
+//   Date: 10/17/2026
+//   Version: 1.0
+//
+//   Environment: Intel Core i7
+//     Software: MS Windows 10 for execution;
+//     Compiles under Microsoft Visual Studio 2015
+//
+//   list<T, Alloc, Stats> privately inherits its Stats policy and calls the
+//   on_* hooks below at each event. no_stats, the default, is empty and its
+//   hooks are empty inline functions, so a list built with it carries no
+//   counters and no calls. list_counters keeps one plain counter per event
+//   for that list; like the list itself it is not thread safe.
+//
+//   struct no_stats:
+//     void on_allocate(), on_free() -- a cell was allocated / freed
+//     void on_index(size_t hops) -- operator[] walked hops cells
+//     void on_size(size_t size) -- the list grew to size elements
+//     void on_copy(size_t n) -- copy constructor or operator= copied n elements
+//     void on_push_front(size_t n = 1), on_push_back(size_t n = 1),
+//          on_pop_front(size_t n = 1), on_pop_back(size_t n = 1) -- n elements
+//          pushed or popped; a bulk transfer (append, push_bulk, push_range,
+//          pop_bulk) reports its whole batch in one call
+//
+//   class list_counters:
+//     same hooks, plus
+//     snapshot get_snapshot() const -- copy of every counter
+//     void reset() -- zeroes every counter
+//
+//   struct list_counters::snapshot:
+//     one unsigned long long per counter, and
+//     void for_each(F f) const -- calls f(name, value) for each counter,
+//                                 for export to a metrics system
+//
+//   History Log:
+//			10/17/2026 RD completed version 1.0
+//			10/17/2026 RD push and pop hooks take a count, bulk transfers are counted
+//-----------------------------------------------------------------------------
+
+#ifndef LIST_STATS_H
+#define LIST_STATS_H
+#include <cstddef>
+
+using namespace std;
+
+namespace RD_ADT
+{
+
+	struct no_stats
+	{
+		void on_allocate() {}
+		void on_free() {}
+		void on_index(size_t) const {}
+		void on_size(size_t) {}
+		void on_copy(size_t) {}
+		void on_push_front(size_t = 1) {}
+		void on_push_back(size_t = 1) {}
+		void on_pop_front(size_t = 1) {}
+		void on_pop_back(size_t = 1) {}
+	};
+
+	class list_counters
+	{
+	public:
+		struct snapshot
+		{
+			unsigned long long allocations;
+			unsigned long long frees;
+			unsigned long long index_calls;
+			unsigned long long index_hops;
+			unsigned long long peak_size;
+			unsigned long long copied_elements;
+			unsigned long long push_front;
+			unsigned long long push_back;
+			unsigned long long pop_front;
+			unsigned long long pop_back;
+
+			template <class F>
+			void for_each(F f) const
+			{
+				f("allocations", allocations);
+				f("frees", frees);
+				f("index_calls", index_calls);
+				f("index_hops", index_hops);
+				f("peak_size", peak_size);
+				f("copied_elements", copied_elements);
+				f("push_front", push_front);
+				f("push_back", push_back);
+				f("pop_front", pop_front);
+				f("pop_back", pop_back);
+			}
+		};
+
+		list_counters() { reset(); }
+
+		void on_allocate() { counts.allocations++; }
+		void on_free() { counts.frees++; }
+		void on_index(size_t hops) const { counts.index_calls++; counts.index_hops += hops; }
+		void on_size(size_t size) { if (size > counts.peak_size) counts.peak_size = size; }
+		void on_copy(size_t n) { counts.copied_elements += n; }
+		void on_push_front(size_t n = 1) { counts.push_front += n; }
+		void on_push_back(size_t n = 1) { counts.push_back += n; }
+		void on_pop_front(size_t n = 1) { counts.pop_front += n; }
+		void on_pop_back(size_t n = 1) { counts.pop_back += n; }
+
+		snapshot get_snapshot() const { return counts; }
+		void reset() { counts = snapshot(); }
+
+	private:
+		mutable snapshot counts; // mutable so operator[] const is counted too
+	};
+}
+
+#endif
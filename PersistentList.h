@@ -0,0 +1,955 @@
+//-----------------------------------------------------------------------------
+//   File: PersistentList.h
+//-----------------------------------------------------------------------------
+
+//-----------------------------------------------------------------------------
+//   Title: persistent_list and persistent_queue Classes
+//   Description: This file contains a list whose copies share their cells,
+//                for many read-mostly snapshots of one queue
+//
+//   Programmer: Reinaldo Daniswara
+//
+//   Date: 10/17/2026
+//   Version: 1.0
+//
+//   Environment: Intel Core i7
+//     Software: MS Windows 10 for execution;
+//     Compiles under Microsoft Visual Studio 2015
+//
+//   class persistent_list<T, Alloc>:
+//
+//     The elements are kept in two singly linked stacks of reference
+//     counted cells: the front stack holds the first elements head first,
+//     the back stack the last elements tail first. Every cell owns one
+//     reference to the cell after it and every list one reference to the
+//     top of each stack, so a copy only takes two references and shares
+//     every cell with the original. Cells are never changed while shared:
+//     a push links one new cell on top of a stack and a pop steps the top
+//     down one cell, leaving the cells below shared.
+//
+//     When a pop finds its stack empty, half of the other stack is turned
+//     around to become it. If the list is the only owner of those cells
+//     they are relinked in place; if any is shared with a copy, the whole
+//     stack is copied instead, so the copy never sees a change. Popping a
+//     cell nothing else holds moves the data out, otherwise it is copied.
+//     Reference counts are atomic, so copies may be used on different
+//     threads; one persistent_list object is not thread safe, like list.
+//
+//     Template Parameters:
+//       T -- element type
+//       Alloc -- allocator policy for the cells, must be always equal since
+//                cells move between copies; pool_allocator<T> by default
+//
+//     Properties:
+//       node *m_front, *m_frontLast -- top and bottom of the front stack
+//       node *m_back, *m_backLast -- top and bottom of the back stack
+//       unsigned m_frontSize, m_backSize -- cells in each stack
+//       node_allocator m_alloc -- hands out cells
+//
+//     Methods:
+//
+//       inline:
+//         persistent_list() -- construct the empty list
+//         persistent_list(const persistent_list& x) -- O(1), shares x's cells
+//         persistent_list(persistent_list&& x) -- takes over x's cells
+//         ~persistent_list() { release(); } -- drops its references
+//         unsigned getSize()const, size_t size()const -- number of elements
+//         bool empty()const -- true if no elements
+//         const T& front()const, back()const -- first and last element
+//         const_iterator begin()const, end()const -- forward iterators
+//         const_iterator begin() -- normalize(), then the first element
+//         void push_front(const T&), push_front(T&&), push_back(...) -- forward
+//                to emplace_front and emplace_back
+//         void release() -- removes all items from list
+//         void swap(persistent_list& x) -- exchanges contents in O(1)
+//         persistent_list& operator=(persistent_list x) -- O(1), shares x's cells
+//
+//       non-inline:
+//         persistent_list(size_t n_elements, const T& datum)
+//         persistent_list(InputIt b, InputIt e) -- copies [b, e) onto the front stack
+//         void emplace_front(Args&&... args), emplace_back(Args&&... args)
+//         T pop_front(), pop_back() -- remove and return an end element
+//         const T& operator[](int index)const -- negative counts from the back
+//         void normalize() -- moves the back stack under the front stack
+//
+//       private:
+//         node* make_node(node* next, Args&&... args) -- new cell, owns next
+//         static void acquire(node* p) -- takes a reference to p
+//         void drop(node* p) -- drops a reference, frees cells nothing holds
+//         void refill_front(), refill_back() -- turns half of the other
+//                                               stack around
+//
+//     Public Nested Structures:
+//
+//      struct node -- cell; T data, node* next, atomic<unsigned> refs
+//
+//      class const_iterator -- forward iterator, front stack top down then
+//                              back stack bottom up; the back stack is
+//                              gathered into a shared array when reached,
+//                              which begin() on a non-const list avoids by
+//                              normalizing first. Valid while the list is
+//                              not modified.
+//
+//   class persistent_queue<T, Alloc>:
+//     the CQueue surface (push, emplace, pop, front, getSize, empty,
+//     release, begin, end) over a protected persistent_list
+//
+//   History Log:
+//			10/17/2026 RD completed version 1.0
+//			10/17/2026 RD range constructor fills the front stack, non-const begin() normalizes
+//-----------------------------------------------------------------------------
+
+#ifndef PERSISTENT_LIST_H
+#define PERSISTENT_LIST_H
+#include <atomic>
+#include <iostream>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+#include "Pool.h"
+#include "Format.h"
+
+using namespace std;
+
+namespace RD_ADT
+{
+
+	template <class T, class Alloc = pool_allocator<T> >
+	class persistent_list
+	{
+	public:
+		struct node; // forward declarations
+		class const_iterator;
+		typedef const_iterator iterator;
+		typedef T value_type;
+		typedef const T& reference;
+		typedef const T& const_reference;
+		typedef size_t size_type;
+		typedef ptrdiff_t difference_type;
+		// constructors
+		persistent_list()
+			: m_front(nullptr), m_frontLast(nullptr), m_back(nullptr), m_backLast(nullptr), m_frontSize(0), m_backSize(0) {}
+		persistent_list(size_t n_elements, const T& datum);
+		persistent_list(const persistent_list& x)
+			: m_front(x.m_front), m_frontLast(x.m_frontLast), m_back(x.m_back), m_backLast(x.m_backLast),
+			m_frontSize(x.m_frontSize), m_backSize(x.m_backSize), m_alloc(x.m_alloc)
+		{
+			acquire(m_front);
+			acquire(m_back);
+		}
+		persistent_list(persistent_list&& x) : persistent_list() { swap(x); }
+		template <class InputIt, class = typename iterator_traits<InputIt>::iterator_category>
+		persistent_list(InputIt b, InputIt e);
+
+		~persistent_list() { release(); }
+		unsigned getSize() const { return m_frontSize + m_backSize; }
+		size_t size() const { return getSize(); }
+		bool empty() const { return getSize() == 0; }
+		const T& front() const { return m_frontSize != 0 ? m_front->data : m_backLast->data; }
+		const T& back() const { return m_backSize != 0 ? m_back->data : m_frontLast->data; }
+		const_iterator begin() const { return const_iterator(m_front, m_frontSize, m_back, m_backSize); }
+		const_iterator begin() { normalize(); return const_iterator(m_front, m_frontSize, nullptr, 0); }
+		const_iterator end() const { return const_iterator(); }
+		const_iterator cbegin() const { return begin(); }
+		const_iterator cend() const { return end(); }
+
+		void push_front(const T& datum) { emplace_front(datum); }
+		void push_front(T&& datum) { emplace_front(std::move(datum)); }
+		template <class... Args>
+		void emplace_front(Args&&... args);
+		T pop_front();
+		void push_back(const T& datum) { emplace_back(datum); }
+		void push_back(T&& datum) { emplace_back(std::move(datum)); }
+		template <class... Args>
+		void emplace_back(Args&&... args);
+		T pop_back();
+
+		void release()
+		{
+			drop(m_front);
+			drop(m_back);
+			m_front = m_frontLast = m_back = m_backLast = nullptr;
+			m_frontSize = m_backSize = 0;
+		}
+		void swap(persistent_list& x)
+		{
+			std::swap(m_front, x.m_front);
+			std::swap(m_frontLast, x.m_frontLast);
+			std::swap(m_back, x.m_back);
+			std::swap(m_backLast, x.m_backLast);
+			std::swap(m_frontSize, x.m_frontSize);
+			std::swap(m_backSize, x.m_backSize);
+		}
+		persistent_list& operator=(persistent_list x) { swap(x); return *this; }
+		const T& operator[](int index) const;
+		void normalize();
+
+	private:
+		typedef typename allocator_traits<Alloc>::template rebind_alloc<node> node_allocator;
+		typedef allocator_traits<node_allocator> node_traits;
+		static_assert(node_traits::is_always_equal::value, "persistent_list shares cells, Alloc must be always equal");
+
+		template <class... Args>
+		node* make_node(node* next, Args&&... args)
+		{
+			node* p = node_traits::allocate(m_alloc, 1);
+			try { node_traits::construct(m_alloc, p, next, std::forward<Args>(args)...); }
+			catch (...) { node_traits::deallocate(m_alloc, p, 1); throw; }
+			return p;
+		}
+		static void acquire(node* p)
+		{
+			if (p != nullptr)
+				p->refs.fetch_add(1, memory_order_relaxed);
+		}
+		static bool unique(const node* p, size_t n)
+		{
+			for (; n > 0; n--, p = p->next)
+				if (p->refs.load(memory_order_acquire) != 1)
+					return false;
+			return true;
+		}
+		void drop(node* p);
+		void refill_front();
+		void refill_back();
+
+		node *m_front;     // first element, top of the front stack
+		node *m_frontLast; // bottom of the front stack
+		node *m_back;      // last element, top of the back stack
+		node *m_backLast;  // bottom of the back stack
+		unsigned m_frontSize;
+		unsigned m_backSize;
+		node_allocator m_alloc; // hands out cells
+	public:
+		struct node // list cell
+		{
+			T data;
+			node *next;
+			atomic<unsigned> refs; // lists and cells pointing here
+			template <class... Args>
+			node(node* n, Args&&... args) : data(std::forward<Args>(args)...), next(n), refs(1) {}
+		};
+		// scoped within class persistent_list !
+		class const_iterator
+		{
+		public:
+			typedef forward_iterator_tag iterator_category;
+			typedef T value_type;
+			typedef ptrdiff_t difference_type;
+			typedef const T* pointer;
+			typedef const T& reference;
+
+			const_iterator() : ptr(nullptr), frontLeft(0), backTop(nullptr), backSize(0), backIndex(0) {}
+			const_iterator(const node* f, unsigned nf, const node* b, unsigned nb)
+				: ptr(f), frontLeft(nf), backTop(b), backSize(nb), backIndex(0)
+			{
+				if (frontLeft == 0)
+					enter_back();
+			}
+			const_iterator& operator++();
+			const_iterator operator++(int) { const_iterator temp = *this; ++*this; return temp; }
+			pointer operator->() const { return &ptr->data; }
+			reference operator*() const { return ptr->data; }
+			friend bool operator==(const const_iterator& a, const const_iterator& b) { return a.ptr == b.ptr; }
+			friend bool operator!=(const const_iterator& a, const const_iterator& b) { return a.ptr != b.ptr; }
+		private:
+			void enter_back();
+
+			const node* ptr; // current cell, nullptr at end()
+			unsigned frontLeft; // front cells left, ptr included
+			const node* backTop;
+			unsigned backSize;
+			shared_ptr<vector<const node*> > backPath; // back stack bottom up, once reached
+			size_t backIndex; // ptr's place in backPath
+		};
+	};
+
+	//-----------------------------------------------------------------------------
+	//    Class:			persistent_list<T>
+	//	  Method:			persistent_list(size_t n_elements, const T& datum)
+	//
+	//	  Description:		n_elements copies of datum on the front stack
+	//
+	//    Calls:            push_front()
+	//    Called By:		main
+	//
+	//    Parameters:		size_t n_elements, const T& datum
+	//
+	//    History Log:
+	//                      10/17/2026 RD completed version
+	//-----------------------------------------------------------------------------
+
+	template <class T, class Alloc>
+	persistent_list<T, Alloc>::persistent_list(size_t n_elements, const T& datum)
+		: persistent_list()
+	{
+		if (n_elements <= 0)
+			throw out_of_range("Empty list");
+		for (size_t i = 0; i < n_elements; i++)
+			push_front(datum);
+	}
+
+	//-----------------------------------------------------------------------------
+	//    Class:			persistent_list<T>
+	//	  Method:			persistent_list(InputIt b, InputIt e)
+	//
+	//	  Description:		copies [b, e) onto the front stack, each new
+	//						cell hooked under the last, so the list walks
+	//						without ever reaching the back stack
+	//
+	//    Calls:            make_node()
+	//    Called By:		main
+	//
+	//    Parameters:		InputIt b, InputIt e -- any input iterators
+	//
+	//    History Log:
+	//                      10/17/2026 RD completed version
+	//                      10/17/2026 RD fills the front stack, not the back one
+	//-----------------------------------------------------------------------------
+
+	template <class T, class Alloc>
+	template <class InputIt, class>
+	persistent_list<T, Alloc>::persistent_list(InputIt b, InputIt e)
+		: persistent_list()
+	{
+		for (; b != e; ++b)
+		{
+			node* p = make_node(nullptr, *b);
+			if (m_frontSize++ == 0)
+				m_front = p;
+			else
+				m_frontLast->next = p; // not shared yet, takes over p's reference
+			m_frontLast = p;
+		}
+	}
+
+	//-----------------------------------------------------------------------------
+	//    Class:			persistent_list<T>
+	//	  Method:			drop(node* p)
+	//
+	//	  Description:		drops one reference to p; a cell left with none
+	//						is freed and the reference it held to the next
+	//						cell dropped in turn, iteratively
+	//
+	//    Calls:            none
+	//    Called By:		release(), pop_front(), pop_back(), refill_*()
+	//
+	//    Parameters:		node* p -- may be nullptr
+	//
+	//    History Log:
+	//                      10/17/2026 RD completed version
+	//-----------------------------------------------------------------------------
+
+	template <class T, class Alloc>
+	void persistent_list<T, Alloc>::drop(node* p)
+	{
+		while (p != nullptr && p->refs.fetch_sub(1, memory_order_acq_rel) == 1)
+		{
+			node* next = p->next;
+			node_traits::destroy(m_alloc, p);
+			node_traits::deallocate(m_alloc, p, 1);
+			p = next;
+		}
+	}
+
+	//-----------------------------------------------------------------------------
+	//    Class:			persistent_list<T>
+	//	  Method:			emplace_front(Args&&... args)
+	//
+	//	  Description:		links a new cell on top of the front stack; the
+	//						cells below stay shared
+	//
+	//    Calls:            make_node()
+	//    Called By:		push_front()
+	//
+	//    Parameters:		Args&&... args
+	//
+	//    History Log:
+	//                      10/17/2026 RD completed version
+	//-----------------------------------------------------------------------------
+
+	template <class T, class Alloc>
+	template <class... Args>
+	void persistent_list<T, Alloc>::emplace_front(Args&&... args)
+	{
+		m_front = make_node(m_front, std::forward<Args>(args)...); // takes over our reference
+		if (m_frontSize++ == 0)
+			m_frontLast = m_front;
+	}
+
+	//-----------------------------------------------------------------------------
+	//    Class:			persistent_list<T>
+	//	  Method:			emplace_back(Args&&... args)
+	//
+	//	  Description:		links a new cell on top of the back stack
+	//
+	//    Calls:            make_node()
+	//    Called By:		push_back()
+	//
+	//    Parameters:		Args&&... args
+	//
+	//    History Log:
+	//                      10/17/2026 RD completed version
+	//-----------------------------------------------------------------------------
+
+	template <class T, class Alloc>
+	template <class... Args>
+	void persistent_list<T, Alloc>::emplace_back(Args&&... args)
+	{
+		m_back = make_node(m_back, std::forward<Args>(args)...);
+		if (m_backSize++ == 0)
+			m_backLast = m_back;
+	}
+
+	//-----------------------------------------------------------------------------
+	//    Class:			persistent_list<T>
+	//	  Method:			pop_front()
+	//
+	//	  Description:		removes the front element, refilling the front
+	//						stack from the back one first if it is empty
+	//	  Return:			data, moved out if no copy shares the cell
+	//
+	//    Calls:            refill_front(), drop()
+	//    Called By:		n/a
+	//
+	//    Parameters:		none
+	//
+	//    History Log:
+	//                      10/17/2026 RD completed version
+	//-----------------------------------------------------------------------------
+
+	template <class T, class Alloc>
+	T persistent_list<T, Alloc>::pop_front()
+	{
+		if (empty())
+			throw runtime_error("Empty list");
+		if (m_frontSize == 0)
+			refill_front();
+
+		node* top = m_front;
+		T data(top->refs.load(memory_order_acquire) == 1 ? std::move(top->data) : top->data);
+		if (--m_frontSize == 0)
+			m_front = m_frontLast = nullptr;
+		else
+		{
+			m_front = top->next;
+			acquire(m_front);
+		}
+		drop(top);
+		return data;
+	}
+
+	//-----------------------------------------------------------------------------
+	//    Class:			persistent_list<T>
+	//	  Method:			pop_back()
+	//
+	//	  Description:		removes the back element, refilling the back
+	//						stack from the front one first if it is empty
+	//	  Return:			data, moved out if no copy shares the cell
+	//
+	//    Calls:            refill_back(), drop()
+	//    Called By:		n/a
+	//
+	//    Parameters:		none
+	//
+	//    History Log:
+	//                      10/17/2026 RD completed version
+	//-----------------------------------------------------------------------------
+
+	template <class T, class Alloc>
+	T persistent_list<T, Alloc>::pop_back()
+	{
+		if (empty())
+			throw runtime_error("Empty list");
+		if (m_backSize == 0)
+			refill_back();
+
+		node* top = m_back;
+		T data(top->refs.load(memory_order_acquire) == 1 ? std::move(top->data) : top->data);
+		if (--m_backSize == 0)
+			m_back = m_backLast = nullptr;
+		else
+		{
+			m_back = top->next;
+			acquire(m_back);
+		}
+		drop(top);
+		return data;
+	}
+
+	//-----------------------------------------------------------------------------
+	//    Class:			persistent_list<T>
+	//	  Method:			refill_front()
+	//
+	//	  Description:		the front stack is empty: the bottom half of the
+	//						back stack (the oldest elements, rounded up)
+	//						becomes the front stack in reverse. Relinked in
+	//						place when this list owns every back cell alone,
+	//						otherwise both halves are copied into new cells
+	//						and the shared ones left untouched
+	//
+	//    Calls:            unique(), make_node(), drop()
+	//    Called By:		pop_front()
+	//
+	//    Parameters:		none
+	//
+	//    History Log:
+	//                      10/17/2026 RD completed version
+	//-----------------------------------------------------------------------------
+
+	template <class T, class Alloc>
+	void persistent_list<T, Alloc>::refill_front()
+	{
+		unsigned m = m_backSize;
+		unsigned keep = m / 2; // stays on the back stack
+		unsigned moved = m - keep;
+
+		if (unique(m_back, m))
+		{
+			node* kept_last = nullptr;
+			node* p = m_back;
+			for (unsigned i = 0; i < keep; i++)
+			{
+				kept_last = p;
+				p = p->next;
+			}
+			// p is the newest of the moved cells, reverse moved cells from it
+			node* reversed = nullptr;
+			m_frontLast = p;
+			for (unsigned i = 0; i < moved; i++)
+			{
+				node* next = p->next;
+				p->next = reversed;
+				reversed = p;
+				p = next;
+			}
+			m_front = reversed;
+			m_frontSize = moved;
+			if (keep == 0)
+				m_back = m_backLast = nullptr;
+			else
+			{
+				kept_last->next = nullptr;
+				m_backLast = kept_last;
+			}
+			m_backSize = keep;
+			return;
+		}
+
+		// shared: build a fresh back stack for the kept cells and a fresh
+		// front stack for the moved ones
+		vector<const node*> cells;
+		cells.reserve(m);
+		for (const node* p = m_back; cells.size() < m; p = p->next)
+			cells.push_back(p); // newest first
+
+		node* back = nullptr;
+		node* backLast = nullptr;
+		node* front = nullptr;
+		node* frontLast = nullptr;
+		try
+		{
+			for (unsigned i = keep; i > 0; i--)
+			{
+				back = make_node(back, cells[i - 1]->data);
+				if (backLast == nullptr)
+					backLast = back;
+			}
+			for (unsigned i = keep; i < m; i++)
+			{
+				front = make_node(front, cells[i]->data);
+				if (frontLast == nullptr)
+					frontLast = front;
+			}
+		}
+		catch (...)
+		{
+			drop(back);
+			drop(front);
+			throw;
+		}
+		drop(m_back);
+		m_back = back;
+		m_backLast = backLast;
+		m_backSize = keep;
+		m_front = front;
+		m_frontLast = frontLast;
+		m_frontSize = moved;
+	}
+
+	//-----------------------------------------------------------------------------
+	//    Class:			persistent_list<T>
+	//	  Method:			refill_back()
+	//
+	//	  Description:		the back stack is empty: the bottom half of the
+	//						front stack (the newest elements, rounded up)
+	//						becomes the back stack in reverse, relinked or
+	//						copied as in refill_front()
+	//
+	//    Calls:            unique(), make_node(), drop()
+	//    Called By:		pop_back()
+	//
+	//    Parameters:		none
+	//
+	//    History Log:
+	//                      10/17/2026 RD completed version
+	//-----------------------------------------------------------------------------
+
+	template <class T, class Alloc>
+	void persistent_list<T, Alloc>::refill_back()
+	{
+		unsigned m = m_frontSize;
+		unsigned keep = m / 2; // stays on the front stack
+		unsigned moved = m - keep;
+
+		if (unique(m_front, m))
+		{
+			node* kept_last = nullptr;
+			node* p = m_front;
+			for (unsigned i = 0; i < keep; i++)
+			{
+				kept_last = p;
+				p = p->next;
+			}
+			node* reversed = nullptr;
+			m_backLast = p;
+			for (unsigned i = 0; i < moved; i++)
+			{
+				node* next = p->next;
+				p->next = reversed;
+				reversed = p;
+				p = next;
+			}
+			m_back = reversed;
+			m_backSize = moved;
+			if (keep == 0)
+				m_front = m_frontLast = nullptr;
+			else
+			{
+				kept_last->next = nullptr;
+				m_frontLast = kept_last;
+			}
+			m_frontSize = keep;
+			return;
+		}
+
+		vector<const node*> cells;
+		cells.reserve(m);
+		for (const node* p = m_front; cells.size() < m; p = p->next)
+			cells.push_back(p); // oldest first
+
+		node* front = nullptr;
+		node* frontLast = nullptr;
+		node* back = nullptr;
+		node* backLast = nullptr;
+		try
+		{
+			for (unsigned i = keep; i > 0; i--)
+			{
+				front = make_node(front, cells[i - 1]->data);
+				if (frontLast == nullptr)
+					frontLast = front;
+			}
+			for (unsigned i = keep; i < m; i++)
+			{
+				back = make_node(back, cells[i]->data);
+				if (backLast == nullptr)
+					backLast = back;
+			}
+		}
+		catch (...)
+		{
+			drop(front);
+			drop(back);
+			throw;
+		}
+		drop(m_front);
+		m_front = front;
+		m_frontLast = frontLast;
+		m_frontSize = keep;
+		m_back = back;
+		m_backLast = backLast;
+		m_backSize = moved;
+	}
+
+	//-----------------------------------------------------------------------------
+	//    Class:			persistent_list<T>
+	//	  Method:			normalize()
+	//
+	//	  Description:		moves the whole back stack, reversed, under the
+	//						bottom of the front stack, so the list is one
+	//						chain head first and iterators never gather the
+	//						back stack. Cells this list owns alone are
+	//						relinked in place; shared back cells are copied,
+	//						and so is the front stack if it is shared, since
+	//						its bottom cell must be changed. Every new cell
+	//						is built before anything is relinked, so a throw
+	//						leaves the list unchanged
+	//
+	//    Calls:            unique(), make_node(), drop()
+	//    Called By:		begin()
+	//
+	//    Parameters:		none
+	//
+	//    History Log:
+	//                      10/17/2026 RD completed version
+	//-----------------------------------------------------------------------------
+
+	template <class T, class Alloc>
+	void persistent_list<T, Alloc>::normalize()
+	{
+		if (m_backSize == 0)
+			return;
+		bool backShared = !unique(m_back, m_backSize);
+		bool frontShared = m_frontSize != 0 && !unique(m_front, m_frontSize);
+
+		node* chain = nullptr; // back cells oldest first, once built
+		node* chainLast = nullptr;
+		node* front = nullptr; // copy of a shared front stack
+		node* frontLast = nullptr;
+		try
+		{
+			if (backShared)
+			{
+				const node* p = m_back;
+				for (unsigned i = 0; i < m_backSize; i++, p = p->next)
+				{
+					chain = make_node(chain, p->data);
+					if (chainLast == nullptr)
+						chainLast = chain;
+				}
+			}
+			if (frontShared)
+			{
+				vector<const node*> cells;
+				cells.reserve(m_frontSize);
+				for (const node* p = m_front; cells.size() < m_frontSize; p = p->next)
+					cells.push_back(p);
+				for (unsigned i = m_frontSize; i > 0; i--)
+				{
+					front = make_node(front, cells[i - 1]->data);
+					if (frontLast == nullptr)
+						frontLast = front;
+				}
+			}
+		}
+		catch (...)
+		{
+			drop(chain);
+			drop(front);
+			throw;
+		}
+
+		if (backShared)
+			drop(m_back);
+		else
+		{
+			node* p = m_back;
+			chainLast = p;
+			for (unsigned i = 0; i < m_backSize; i++)
+			{
+				node* next = p->next;
+				p->next = chain;
+				chain = p;
+				p = next;
+			}
+		}
+		if (frontShared)
+		{
+			drop(m_front);
+			m_front = front;
+			m_frontLast = frontLast;
+		}
+
+		if (m_frontSize == 0)
+			m_front = chain;
+		else
+			m_frontLast->next = chain; // takes over the chain's reference
+		m_frontLast = chainLast;
+		m_frontSize += m_backSize;
+		m_back = m_backLast = nullptr;
+		m_backSize = 0;
+	}
+
+	//-----------------------------------------------------------------------------
+	//    Class:			persistent_list<T>
+	//	  Method:			operator[](int index)const
+	//
+	//	  Description:		element at index, walked down whichever stack
+	//						holds it; negative indices count from the back
+	//	  Return:			data at index
+	//
+	//    Calls:            none
+	//    Called By:		main
+	//
+	//    Parameters:		int index
+	//
+	//    History Log:
+	//                      10/17/2026 RD completed version
+	//-----------------------------------------------------------------------------
+
+	template <class T, class Alloc>
+	const T& persistent_list<T, Alloc>::operator[](int index) const
+	{
+		int size = static_cast<int>(getSize());
+		if (index >= size || index < -size)
+			throw out_of_range("index out-of-range");
+		unsigned pos = static_cast<unsigned>(index >= 0 ? index : size + index);
+
+		const node* p;
+		unsigned steps;
+		if (pos < m_frontSize)
+		{
+			p = m_front;
+			steps = pos;
+		}
+		else
+		{
+			p = m_back;
+			steps = m_backSize - 1 - (pos - m_frontSize);
+		}
+		for (; steps > 0; steps--)
+			p = p->next;
+		return p->data;
+	}
+
+	//-----------------------------------------------------------------------------
+	//    Class:			persistent_list<T>
+	//	  Method:			const_iterator::operator++()
+	//
+	//	  Description:		pre-increment, down the front stack, then up the
+	//						back stack through backPath
+	//	  Return:			*this
+	//
+	//    Calls:            enter_back()
+	//    Called By:		operator++(int)
+	//
+	//    Parameters:		none
+	//
+	//    History Log:
+	//                      10/17/2026 RD completed version
+	//-----------------------------------------------------------------------------
+
+	template <class T, class Alloc>
+	typename persistent_list<T, Alloc>::const_iterator& persistent_list<T, Alloc>::const_iterator::operator++()
+	{
+		if (ptr == nullptr)
+			throw runtime_error("nullptr pointer");
+		if (frontLeft > 1)
+		{
+			frontLeft--;
+			ptr = ptr->next;
+		}
+		else if (frontLeft == 1)
+		{
+			frontLeft = 0;
+			enter_back();
+		}
+		else
+			ptr = ++backIndex < backPath->size() ? (*backPath)[backIndex] : nullptr;
+		return *this;
+	}
+
+	//-----------------------------------------------------------------------------
+	//    Class:			persistent_list<T>
+	//	  Method:			const_iterator::enter_back()
+	//
+	//	  Description:		gathers the back stack bottom up into backPath,
+	//						shared by copies of this iterator, and moves to
+	//						its first cell
+	//
+	//    Calls:            none
+	//    Called By:		const_iterator(), operator++()
+	//
+	//    Parameters:		none
+	//
+	//    History Log:
+	//                      10/17/2026 RD completed version
+	//-----------------------------------------------------------------------------
+
+	template <class T, class Alloc>
+	void persistent_list<T, Alloc>::const_iterator::enter_back()
+	{
+		if (backSize == 0)
+		{
+			ptr = nullptr;
+			return;
+		}
+		backPath = make_shared<vector<const node*> >(backSize);
+		const node* p = backTop;
+		for (unsigned i = backSize; i > 0; i--, p = p->next)
+			(*backPath)[i - 1] = p;
+		backIndex = 0;
+		ptr = (*backPath)[0];
+	}
+
+	//-----------------------------------------------------------------------------
+	//    Class:			persistent_queue<T>
+	//
+	//	  Description:		CQueue's surface over persistent_list; copying a
+	//						queue, or building one from a persistent_list,
+	//						is O(1)
+	//
+	//    History Log:
+	//                      10/17/2026 RD completed version
+	//-----------------------------------------------------------------------------
+
+	template <class T, class Alloc = pool_allocator<T> >
+	class persistent_queue : protected persistent_list<T, Alloc>
+	{
+		typedef persistent_list<T, Alloc> base;
+	public:
+		typedef typename base::const_iterator iterator;
+		typedef typename base::const_iterator const_iterator;
+		typedef T value_type;
+
+		persistent_queue() : base() {}
+		persistent_queue(const base& other) : base(other) {}
+		persistent_queue(base&& other) : base(std::move(other)) {}
+		template <class InputIt, class = typename iterator_traits<InputIt>::iterator_category>
+		persistent_queue(InputIt b, InputIt e) : base(b, e) {}
+
+		unsigned getSize() const { return base::getSize(); }
+		const_iterator begin() const { return base::begin(); }
+		const_iterator begin() { return base::begin(); }
+		const_iterator end() const { return base::end(); }
+		bool empty() const { return base::empty(); }
+		void release() { base::release(); }
+		const T& front() const { return base::front(); }
+		void push(const T& element) { base::push_back(element); }
+		void push(T&& element) { base::push_back(std::move(element)); }
+		template <class... Args>
+		void emplace(Args&&... args) { base::emplace_back(std::forward<Args>(args)...); }
+		T pop() { return base::pop_front(); }
+	};
+
+	//-----------------------------------------------------------------------------
+	//	  Function:			ostream& operator<<(ostream& sout, const persistent_list<T>& x)
+	//						ostream& operator<<(ostream& sout, const persistent_queue<T>& x)
+	//	  Description:		displays elements to sout
+	//
+	//    Calls:            print_list()
+	//
+	//    Parameters:		ostream& sout, x
+	//	  Returns:          ostream & sout
+	//
+	//    History Log:
+	//                      10/17/2026 RD completed version
+	//-----------------------------------------------------------------------------
+
+	template <class T, class Alloc>
+	ostream& operator<<(ostream& sout, const persistent_list<T, Alloc>& x)
+	{
+		return print_list(sout, x);
+	}
+
+	template <class T, class Alloc>
+	ostream& operator<<(ostream& sout, const persistent_queue<T, Alloc>& x)
+	{
+		return print_list(sout, x);
+	}
+}
+
+#endif
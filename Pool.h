@@ -0,0 +1,379 @@
+//-----------------------------------------------------------------------------
+//   File: Pool.h
+//-----------------------------------------------------------------------------
+
+//-----------------------------------------------------------------------------
+//   Title: node_pool and pool_allocator Classes
+//   Description: This file contains the slab allocator used for list cells
+//
+//   Programmer: Reinaldo Daniswara
+//
+//   Date: 10/17/2026
+//   Version: 1.0
+//
+//   Environment: Intel Core i7
+//     Software: MS Windows 10 for execution;
+//     Compiles under Microsoft Visual Studio 2015
+//
+//   class node_pool<Size, Align>:
+//
+//     Hands out fixed-size cells carved from contiguous blocks. Freed cells
+//     go onto a free list and are handed out again before any new block is
+//     requested, so a warm pool never touches the global heap. There is one
+//     pool per thread and per cell size; when a thread exits its free cells
+//     are parked in a shared reserve that other threads refill from. Blocks
+//     are kept for the lifetime of the process.
+//
+//     A cell goes back to the pool of the thread that frees it, not the one
+//     that allocated it. So that a thread which only frees (the consumer of
+//     a queue filled by another thread) cannot hoard cells while the
+//     allocating thread keeps carving new blocks, a free list that grows
+//     past max_free cells keeps its newest kept_free and parks the rest in
+//     the shared reserve as one batch; a thread whose free list runs dry
+//     takes one batch back. Cross-thread frees therefore cost one locked
+//     hand-off per few thousand cells, and memory stays bounded by what is
+//     live plus about max_free cells per thread.
+//
+//     A thread's pool is destroyed with its other thread_locals, which can
+//     be before a static or global container is. Once it is gone, cells
+//     that thread frees go straight to the shared reserve and cells it
+//     allocates come from there, so such containers stay safe to destroy.
+//
+//     Methods:
+//
+//       inline:
+//         static void* get() -- one cell for the calling thread
+//         static void put(void* p) -- gives a cell back on the calling thread
+//         static node_pool& local() -- the calling thread's pool, while alive
+//         void* allocate() -- returns one cell
+//         void deallocate(void* p) -- puts a cell back on the free list
+//
+//       non-inline:
+//         ~node_pool() -- parks the free list in the shared reserve
+//         void refill() -- takes a batch from the reserve or carves a new block
+//         void spill() -- parks all but kept_free free cells in the reserve
+//         static void* get_shared() -- one cell from the reserve, or new
+//         static void put_shared(void* p) -- one cell into the reserve
+//
+//   class pool_allocator<T>:
+//
+//     Standard allocator that takes single objects from node_pool and
+//     anything larger from ::operator new. It is stateless, so any two
+//     instances compare equal and nodes may move between lists freely.
+//
+//   History Log:
+//			10/17/2026 RD completed version 1.0
+//			10/17/2026 RD free lists capped, excess goes to the shared reserve
+//			10/17/2026 RD cells freed after the thread's pool is gone go to the reserve
+//-----------------------------------------------------------------------------
+
+#ifndef POOL_H
+#define POOL_H
+#include <cstddef>
+#include <new>
+#include <mutex>
+#include <type_traits>
+#include <vector>
+
+using namespace std;
+
+namespace RD_ADT
+{
+
+	template <size_t Size, size_t Align>
+	class node_pool
+	{
+	public:
+		static void* get() { return state() == dead ? get_shared() : local().allocate(); }
+		static void put(void* p)
+		{
+			if (state() == dead)
+				put_shared(p);
+			else
+				local().deallocate(p);
+		}
+
+		static node_pool& local()
+		{
+			thread_local node_pool pool;
+			return pool;
+		}
+
+		void* allocate()
+		{
+			if (free_list == nullptr)
+				refill();
+			cell* c = free_list;
+			free_list = c->next;
+			free_count--;
+			return c;
+		}
+
+		void deallocate(void* p)
+		{
+			cell* c = static_cast<cell*>(p);
+			c->next = free_list;
+			free_list = c;
+			if (++free_count > max_free)
+				spill();
+		}
+
+		~node_pool();
+
+	private:
+		enum { unborn, alive, dead };
+		static unsigned char& state()
+		{
+			thread_local unsigned char s = unborn; // trivially destructible, outlives the pool
+			return s;
+		}
+		static void* get_shared();
+		static void put_shared(void* p);
+
+		struct cell { cell* next; };
+
+		// a cell must hold the free-list link and keep the requested alignment
+		static const size_t align = Align > alignof(cell) ? Align : alignof(cell);
+		static const size_t raw_size = Size > sizeof(cell) ? Size : sizeof(cell);
+		static const size_t cell_size = (raw_size + align - 1) / align * align;
+		static const size_t first_block = 64;     // cells in the first block
+		static const size_t max_block = 4096;     // cells in the largest block
+		static const size_t max_free = 2 * max_block; // longest free list a thread keeps
+		static const size_t kept_free = 256;      // cells a spill leaves on the free list
+
+		static_assert(align <= alignof(max_align_t), "over-aligned cells are not supported");
+
+		struct batch
+		{
+			cell* free_list; // null terminated chain
+			size_t free_count;
+		};
+		struct reserve
+		{
+			mutex lock;
+			vector<batch> batches; // uses std::allocator, never this pool
+		};
+		static reserve& shared()
+		{
+			static reserve* r = new reserve; // never destroyed, outlives every thread
+			return *r;
+		}
+
+		node_pool() : free_list(nullptr), free_count(0), next_block(first_block) { state() = alive; }
+		void refill();
+		void spill();
+
+		cell* free_list;
+		size_t free_count; // cells on free_list
+		size_t next_block; // cells to carve from the next block
+	};
+
+	//-----------------------------------------------------------------------------
+	//    Class:			node_pool<Size, Align>
+	//	  Method:			~node_pool()
+	//
+	//	  Description:		parks this thread's free cells in the shared reserve
+	//						and marks the pool dead for later get() and put()
+	//
+	//    Calls:            shared()
+	//    Called By:		thread exit
+	//
+	//    Parameters:		none
+	//
+	//    History Log:
+	//                      10/17/2026 RD completed version
+	//-----------------------------------------------------------------------------
+
+	template <size_t Size, size_t Align>
+	node_pool<Size, Align>::~node_pool()
+	{
+		state() = dead;
+		if (free_list == nullptr)
+			return;
+		reserve& r = shared();
+		lock_guard<mutex> guard(r.lock);
+		r.batches.push_back(batch{ free_list, free_count });
+		free_list = nullptr;
+		free_count = 0;
+	}
+
+	//-----------------------------------------------------------------------------
+	//    Class:			node_pool<Size, Align>
+	//	  Method:			spill()
+	//
+	//	  Description:		keeps the first kept_free cells of the free list,
+	//						the most recently freed, and parks the rest in the
+	//						shared reserve as one batch, so frees on one thread
+	//						feed allocations on another
+	//
+	//    Calls:            shared()
+	//    Called By:		deallocate()
+	//
+	//    Parameters:		none
+	//
+	//    History Log:
+	//                      10/17/2026 RD completed version
+	//-----------------------------------------------------------------------------
+
+	template <size_t Size, size_t Align>
+	void node_pool<Size, Align>::spill()
+	{
+		cell* last = free_list;
+		for (size_t i = 1; i < kept_free; i++)
+			last = last->next;
+		batch rest{ last->next, free_count - kept_free };
+		last->next = nullptr;
+		free_count = kept_free;
+
+		reserve& r = shared();
+		lock_guard<mutex> guard(r.lock);
+		r.batches.push_back(rest);
+	}
+
+	//-----------------------------------------------------------------------------
+	//    Class:			node_pool<Size, Align>
+	//	  Method:			refill()
+	//
+	//	  Description:		takes the newest batch of the shared reserve if it
+	//						has one, otherwise carves a new block into the
+	//						free list. Block sizes double up to max_block cells.
+	//
+	//    Calls:            shared(), ::operator new
+	//    Called By:		allocate()
+	//
+	//    Parameters:		none
+	//
+	//    History Log:
+	//                      10/17/2026 RD completed version
+	//-----------------------------------------------------------------------------
+
+	template <size_t Size, size_t Align>
+	void node_pool<Size, Align>::refill()
+	{
+		{
+			reserve& r = shared();
+			lock_guard<mutex> guard(r.lock);
+			if (!r.batches.empty())
+			{
+				free_list = r.batches.back().free_list;
+				free_count = r.batches.back().free_count;
+				r.batches.pop_back();
+				return;
+			}
+		}
+
+		size_t n = next_block;
+		if (next_block < max_block)
+			next_block *= 2;
+
+		char* block = static_cast<char*>(::operator new(n * cell_size));
+		for (size_t i = n; i > 0; i--)
+		{
+			cell* c = reinterpret_cast<cell*>(block + (i - 1) * cell_size);
+			c->next = free_list;
+			free_list = c;
+		}
+		free_count = n;
+	}
+
+	//-----------------------------------------------------------------------------
+	//    Class:			node_pool<Size, Align>
+	//	  Method:			get_shared()
+	//
+	//	  Description:		one cell for a thread whose pool is gone: off the
+	//						newest reserve batch, or from ::operator new
+	//	  Return:			the cell
+	//
+	//    Calls:            shared(), ::operator new
+	//    Called By:		get()
+	//
+	//    Parameters:		none
+	//
+	//    History Log:
+	//                      10/17/2026 RD completed version
+	//-----------------------------------------------------------------------------
+
+	template <size_t Size, size_t Align>
+	void* node_pool<Size, Align>::get_shared()
+	{
+		{
+			reserve& r = shared();
+			lock_guard<mutex> guard(r.lock);
+			if (!r.batches.empty())
+			{
+				batch& b = r.batches.back();
+				cell* c = b.free_list;
+				b.free_list = c->next;
+				if (--b.free_count == 0)
+					r.batches.pop_back();
+				return c;
+			}
+		}
+		return ::operator new(cell_size); // parked later like any other cell
+	}
+
+	//-----------------------------------------------------------------------------
+	//    Class:			node_pool<Size, Align>
+	//	  Method:			put_shared(void* p)
+	//
+	//	  Description:		one cell from a thread whose pool is gone, pushed
+	//						onto the newest reserve batch
+	//
+	//    Calls:            shared()
+	//    Called By:		put()
+	//
+	//    Parameters:		void* p
+	//
+	//    History Log:
+	//                      10/17/2026 RD completed version
+	//-----------------------------------------------------------------------------
+
+	template <size_t Size, size_t Align>
+	void node_pool<Size, Align>::put_shared(void* p)
+	{
+		cell* c = static_cast<cell*>(p);
+		reserve& r = shared();
+		lock_guard<mutex> guard(r.lock);
+		if (r.batches.empty())
+			r.batches.push_back(batch{ nullptr, 0 });
+		batch& b = r.batches.back();
+		c->next = b.free_list;
+		b.free_list = c;
+		b.free_count++;
+	}
+
+	template <class T>
+	class pool_allocator
+	{
+	public:
+		typedef T value_type;
+		typedef true_type is_always_equal;
+		typedef true_type propagate_on_container_move_assignment;
+
+		pool_allocator() {}
+		template <class U>
+		pool_allocator(const pool_allocator<U>&) {}
+
+		T* allocate(size_t n)
+		{
+			if (n == 1)
+				return static_cast<T*>(node_pool<sizeof(T), alignof(T)>::get());
+			return static_cast<T*>(::operator new(n * sizeof(T)));
+		}
+
+		void deallocate(T* p, size_t n)
+		{
+			if (n == 1)
+				node_pool<sizeof(T), alignof(T)>::put(p);
+			else
+				::operator delete(p);
+		}
+	};
+
+	template <class T, class U>
+	bool operator==(const pool_allocator<T>&, const pool_allocator<U>&) { return true; }
+	template <class T, class U>
+	bool operator!=(const pool_allocator<T>&, const pool_allocator<U>&) { return false; }
+}
+
+#endif
@@ -21,33 +21,51 @@
 //						Software: MS Windows 10 for execution;
 //						Compiles under Microsoft Visual Studio 2015
 // 
-//	  class CQueue:
+//	  class CQueue<T, Alloc, Stats>:
+//
+//	  Template Parameters:
+//		T -- element type
+//		Alloc -- allocator policy handed through to list<T, Alloc, Stats>
+//				 small_queue<T, N> uses inline_allocator<T, N>, so a queue
+//				 that never holds more than N items never allocates
+//		Stats -- instrumentation policy handed through to list (see ListStats.h)
 //
 //	  Methods:
 //	
 //		inline:	
-//		CQueue() : list() {} -- constructor of the queue
-//		CQueue(size_t size, T datum) -- create a list of a specific size, all elements the same
+//		CQueue() : base() {} -- constructor of the queue
+//		CQueue(size_t size, const T& datum) -- create a list of a specific size, all elements the same
 //		CQueue(const list<T>& other) -- copy constructor
-//		CQueue(iterator b, iterator e) -- constructor using iterators
+//		CQueue(list<T>&& other) -- takes over the cells of other
+//		CQueue(InputIt b, InputIt e) -- copies [b, e) from any input iterators
+//		CQueue(const CQueue&), CQueue(CQueue&&), operator= -- defaulted copy and move
 //
-//		~CQueue() -- destructor
 //		unsigned getSize() const -- accessor, returns m_size
-//		iterator begin() const -- return list<T>::begin()
-//		iterator end() const -- return list<T>::end()
+//		begin(), end(), cbegin(), cend() -- return list<T>'s, end() is past the last element
 //
 //		bool empty()const -- return true if it is empty
 //		void release() -- remove items from list
-//		void push(T& element) -- insert item at the last element, 
-//								parameter T& element
-//		T pop() -- remove an item at the begining of the element, 
+//		void push(const T& element), push(T&& element) -- insert item at the last element
+//		void emplace(Args&&... args) -- insert item built in place at the last element
+//		T pop() -- remove an item at the begining of the element, returns it moved out
+//		void push_bulk(list<T>&& batch) -- links the whole batch onto the tail in O(1)
+//		list<T> pop_bulk(size_t n) -- detaches the first n items as a list
+//		Stats& stats() -- the list's instrumentation policy
 //
 //		non-inline:
+//			void push_range(InputIt first, InputIt last) -- builds a batch, then push_bulk
 //			ostream& operator<<(ostream& sout, const CQueue<T>& x) 
 //					-- print out elements
 //    
 //    History Log:
 //                           5/19/2016  RD  completed version 1.0
+//                           10/17/2026 RD  allocator policy passed through to list
+//                           10/17/2026 RD  move semantics, emplace, push takes temporaries
+//                           10/17/2026 RD  bulk push/pop by relinking whole batches
+//                           10/17/2026 RD  instrumentation policy passed through to list
+//                           10/17/2026 RD  standard iterators with a past-the-end sentinel
+//                           10/17/2026 RD  operator<< renders through list_formatter (Format.h)
+//                           10/17/2026 RD  small_queue keeps its first cells inline
 // ----------------------------------------------------------------------------
 
 
@@ -59,26 +77,81 @@ using namespace std;
 
 namespace RD_ADT
 {
-	template <class T>
-	class CQueue : protected list<T>
+	template <class T, class Alloc = pool_allocator<T>, class Stats = no_stats>
+	class CQueue : protected list<T, Alloc, Stats>
 	{
+		typedef list<T, Alloc, Stats> base;
 	public:
-		CQueue() : list() {}
-		CQueue(size_t size, T datum) : list(size, datum) {}
-		CQueue(const list<T>& other) : list(other) {}
-		CQueue(iterator b, iterator e) : list(b, e) {}
-
-		~CQueue() { release(); }
-		unsigned getSize() const { return m_size; }
-		iterator begin() const { return list<T>::begin(); }
-		iterator end() const { return list<T>::end(); }
-
-		bool empty()const { return list<T>::empty(); }
-		void release() { list<T>::release(); }
-		void push(T& element) { push_back(element); }
-		T pop() { return pop_front(); }
+		typedef typename base::iterator iterator;
+		typedef typename base::const_iterator const_iterator;
+		typedef T value_type;
+
+		CQueue() : base() {}
+		CQueue(size_t size, const T& datum) : base(size, datum) {}
+		CQueue(const base& other) : base(other) {}
+		CQueue(base&& other) : base(std::move(other)) {}
+		template <class InputIt, class = typename iterator_traits<InputIt>::iterator_category>
+		CQueue(InputIt b, InputIt e) : base(b, e) {}
+		CQueue(const CQueue& other) = default;
+		CQueue(CQueue&& other) = default;
+		CQueue& operator=(const CQueue& other) = default;
+		CQueue& operator=(CQueue&& other) = default;
+
+		unsigned getSize() const { return base::getSize(); }
+		iterator begin() { return base::begin(); }
+		const_iterator begin() const { return base::begin(); }
+		iterator end() { return base::end(); }
+		const_iterator end() const { return base::end(); }
+		const_iterator cbegin() const { return base::cbegin(); }
+		const_iterator cend() const { return base::cend(); }
+
+		bool empty()const { return base::empty(); }
+		void release() { base::release(); }
+		void push(const T& element) { base::push_back(element); }
+		void push(T&& element) { base::push_back(std::move(element)); }
+		template <class... Args>
+		void emplace(Args&&... args) { base::emplace_back(std::forward<Args>(args)...); }
+		T pop() { return base::pop_front(); }
+
+		void push_bulk(base&& batch) { base::link_back(batch); }
+		template <class InputIt>
+		void push_range(InputIt first, InputIt last);
+		base pop_bulk(size_t n) { return base::unlink_front(n); }
+
+		Stats& stats() { return base::stats(); }
+		const Stats& stats() const { return base::stats(); }
 	};
 
+	// a queue whose first N cells live inside the queue object
+	template <class T, size_t N, class Stats = no_stats>
+	using small_queue = CQueue<T, inline_allocator<T, N>, Stats>;
+
+	//-----------------------------------------------------------------------------
+	//    Class:			CQueue
+	//	  Method:			push_range(InputIt first, InputIt last)
+	//
+	//	  Description:		builds [first, last) into a batch, then links the
+	//						whole batch onto the tail at once
+	//
+	//    Calls:            push_bulk()
+	//    Called By:		main
+	//
+	//    Parameters:		InputIt first, InputIt last
+	//
+	//    History Log:
+	//                      10/17/2026 RD completed version
+	//-----------------------------------------------------------------------------
+
+	template <class T, class Alloc, class Stats>
+	template <class InputIt>
+	void CQueue<T, Alloc, Stats>::push_range(InputIt first, InputIt last)
+	{
+		base batch;
+		for (; first != last; ++first)
+			batch.push_back(*first);
+		push_bulk(std::move(batch));
+	}
+
 	//-----------------------------------------------------------------------------
 	//    Class:			CQueue
 	//	  Function:			ostream& operator<<(ostream& sout, const CQueue<T>& x)
@@ -88,7 +161,7 @@ namespace RD_ADT
 	//				
 	//	  Output:			elements to sout
 	// 
-	//    Calls:            none
+	//    Calls:            print_list()
 	//    Called By:		main
 	// 
 	//    Parameters:		ostream& sout, const CQueue<T>& x
@@ -96,24 +169,14 @@ namespace RD_ADT
 	//
 	//    History Log:
 	//                      5/19/2016 RD completed version
+	//                      10/17/2026 RD stops at the sentinel end
+	//                      10/17/2026 RD formats into one buffer, one write
 	//-----------------------------------------------------------------------------
 
-	template <class T>
-	ostream& operator<<(ostream& sout, const CQueue<T>& x)
+	template <class T, class Alloc, class Stats>
+	ostream& operator<<(ostream& sout, const CQueue<T, Alloc, Stats>& x)
 	{
-		list<T>::iterator p = x.begin(); // gets x.h
-		sout << "(";
-		while (p != x.end())
-		{
-			sout << *p;
-			if (p != nullptr)
-				sout << ", ";
-			++p; // advances iterator using next
-		}
-		if (p != nullptr)
-			sout << *p;
-		sout << ")\n";
-		return sout;
+		return print_list(sout, x);
 	}
 }
 
@@ -0,0 +1,333 @@
+//-----------------------------------------------------------------------------
+//   File: RingQueue.h
+//-----------------------------------------------------------------------------
+
+//-------------------------------------------------------------------------------------------
+//    Class:			CRingQueue
+//
+//    File:             RingQueue.h
+//
+//    Title:            CRingQueue Class
+//
+//    Description:		This file contains the class definition for CRingQueue,
+//						a bounded single-producer single-consumer queue on a
+//						ring buffer with the push/pop/empty/getSize surface
+//						of CQueue
+//
+//    Programmer:		Reinaldo Daniswara
+//
+//    Date:             10/17/2026
+//
+//    Version:          1.0
+//
+//   Environment:		Intel COre i7
+//						Software: MS Windows 10 for execution;
+//						Compiles under Microsoft Visual Studio 2015
+//
+//	  class CRingQueue<T>:
+//
+//	  Exactly one thread may push and exactly one thread may pop. The
+//	  producer owns m_tail and the consumer owns m_head; each keeps a
+//	  cached copy of the other's index on its own cache line and only
+//	  reloads it when the cached value says the ring is full or empty, so
+//	  try_push and try_pop finish in a bounded number of steps. Indices run
+//	  freely and are masked into the ring, whose capacity is rounded up to
+//	  a power of two.
+//
+//	  Methods:
+//
+//		inline:
+//		CRingQueue(size_t capacity) -- ring of at least capacity slots
+//		~CRingQueue() -- destroys what is left, queue must be idle
+//		size_t capacity() const -- number of slots
+//		unsigned getSize() const -- number of elements, a snapshot
+//		bool empty() const -- true if no elements
+//		void push(const T&), push(T&&) -- try_push, throws if full
+//		T pop() -- removes the front element, throws if empty
+//		bool try_push(const T&), try_push(T&&) -- forward to try_emplace
+//		bool readable(size_t head) -- private, reloads m_tailCache when needed
+//
+//		non-inline:
+//		bool try_emplace(Args&&... args) -- false if the ring is full
+//		bool try_pop(T& out) -- false if the ring is empty
+//		size_t try_push_bulk(InputIt first, size_t n) -- pushes up to n
+//								elements, publishes them with one store
+//		size_t try_pop_bulk(OutputIt out, size_t n) -- pops up to n
+//								elements, frees their slots with one store
+//
+//    History Log:
+//                           10/17/2026  RD  completed version 1.0
+// ----------------------------------------------------------------------------
+
+#ifndef RING_QUEUE_H
+#define RING_QUEUE_H
+#include <atomic>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <utility>
+
+using namespace std;
+
+namespace RD_ADT
+{
+	template <class T>
+	class CRingQueue
+	{
+	public:
+		explicit CRingQueue(size_t capacity);
+		CRingQueue(const CRingQueue&) = delete;
+		CRingQueue& operator=(const CRingQueue&) = delete;
+		~CRingQueue()
+		{
+			for (size_t i = m_head.load(); i != m_tail.load(); ++i)
+				m_slots[i & m_mask].~T();
+			allocator<T>().deallocate(m_slots, m_mask + 1);
+		}
+
+		size_t capacity() const { return m_mask + 1; }
+		unsigned getSize() const
+		{
+			size_t head = m_head.load(memory_order_acquire); // head first: it never passes the later tail
+			size_t tail = m_tail.load(memory_order_acquire);
+			return tail > head ? static_cast<unsigned>(tail - head) : 0;
+		}
+		bool empty() const { return getSize() == 0; }
+
+		void push(const T& element) { if (!try_emplace(element)) throw overflow_error("Full queue"); }
+		void push(T&& element) { if (!try_emplace(std::move(element))) throw overflow_error("Full queue"); }
+		T pop()
+		{
+			size_t head = m_head.load(memory_order_relaxed);
+			if (!readable(head))
+				throw runtime_error("Empty list");
+			T* slot = m_slots + (head & m_mask);
+			T data(std::move(*slot));
+			slot->~T();
+			m_head.store(head + 1, memory_order_release);
+			return data;
+		}
+
+		bool try_push(const T& element) { return try_emplace(element); }
+		bool try_push(T&& element) { return try_emplace(std::move(element)); }
+		template <class... Args>
+		bool try_emplace(Args&&... args);
+		bool try_pop(T& out);
+
+		template <class InputIt>
+		size_t try_push_bulk(InputIt first, size_t n);
+		template <class OutputIt>
+		size_t try_pop_bulk(OutputIt out, size_t n);
+
+	private:
+		// consumer only; true if slot head holds an element
+		bool readable(size_t head)
+		{
+			if (head != m_tailCache)
+				return true;
+			m_tailCache = m_tail.load(memory_order_acquire);
+			return head != m_tailCache;
+		}
+
+		// producer side
+		alignas(64) atomic<size_t> m_tail; // next slot to fill
+		size_t m_headCache;                // last m_head the producer saw
+		// consumer side
+		alignas(64) atomic<size_t> m_head; // next slot to empty
+		size_t m_tailCache;                // last m_tail the consumer saw
+		// shared, read-only after construction
+		alignas(64) size_t m_mask;
+		T* m_slots;
+	};
+
+	//-----------------------------------------------------------------------------
+	//    Class:			CRingQueue
+	//	  Method:			CRingQueue(size_t capacity)
+	//
+	//	  Description:		allocates a ring of capacity slots rounded up to a
+	//						power of two
+	//
+	//    Calls:            none
+	//    Called By:		main
+	//
+	//    Parameters:		size_t capacity
+	//
+	//    History Log:
+	//                      10/17/2026 RD completed version
+	//-----------------------------------------------------------------------------
+
+	template <class T>
+	CRingQueue<T>::CRingQueue(size_t capacity)
+		: m_tail(0), m_headCache(0), m_head(0), m_tailCache(0), m_mask(0), m_slots(nullptr)
+	{
+		if (capacity == 0)
+			throw out_of_range("Empty ring");
+		size_t size = 1;
+		while (size < capacity)
+			size <<= 1;
+		m_mask = size - 1;
+		m_slots = allocator<T>().allocate(size);
+	}
+
+	//-----------------------------------------------------------------------------
+	//    Class:			CRingQueue
+	//	  Method:			try_emplace(Args&&... args)
+	//
+	//	  Description:		producer only; builds the element in the next slot
+	//						and publishes it
+	//
+	//    Calls:            none
+	//    Called By:		push(), try_push()
+	//
+	//    Parameters:		Args&&... args
+	//	  Return:			false if the ring is full
+	//
+	//    History Log:
+	//                      10/17/2026 RD completed version
+	//-----------------------------------------------------------------------------
+
+	template <class T>
+	template <class... Args>
+	bool CRingQueue<T>::try_emplace(Args&&... args)
+	{
+		size_t tail = m_tail.load(memory_order_relaxed);
+		if (tail - m_headCache > m_mask)
+		{
+			m_headCache = m_head.load(memory_order_acquire);
+			if (tail - m_headCache > m_mask)
+				return false;
+		}
+		::new (static_cast<void*>(m_slots + (tail & m_mask))) T(std::forward<Args>(args)...);
+		m_tail.store(tail + 1, memory_order_release);
+		return true;
+	}
+
+	//-----------------------------------------------------------------------------
+	//    Class:			CRingQueue
+	//	  Method:			try_pop(T& out)
+	//
+	//	  Description:		consumer only; moves the front element into out
+	//						and frees its slot
+	//
+	//    Calls:            readable()
+	//    Called By:		n/a
+	//
+	//    Parameters:		T& out
+	//	  Return:			false if the ring is empty
+	//
+	//    History Log:
+	//                      10/17/2026 RD completed version
+	//-----------------------------------------------------------------------------
+
+	template <class T>
+	bool CRingQueue<T>::try_pop(T& out)
+	{
+		size_t head = m_head.load(memory_order_relaxed);
+		if (!readable(head))
+			return false;
+		T* slot = m_slots + (head & m_mask);
+		out = std::move(*slot);
+		slot->~T();
+		m_head.store(head + 1, memory_order_release);
+		return true;
+	}
+
+	//-----------------------------------------------------------------------------
+	//    Class:			CRingQueue
+	//	  Method:			try_push_bulk(InputIt first, size_t n)
+	//
+	//	  Description:		producer only; copies as many of the n elements
+	//						from first as fit, then publishes them all with a
+	//						single store to m_tail
+	//
+	//    Calls:            none
+	//    Called By:		n/a
+	//
+	//    Parameters:		InputIt first, size_t n
+	//	  Return:			number of elements pushed
+	//
+	//    History Log:
+	//                      10/17/2026 RD completed version
+	//-----------------------------------------------------------------------------
+
+	template <class T>
+	template <class InputIt>
+	size_t CRingQueue<T>::try_push_bulk(InputIt first, size_t n)
+	{
+		size_t tail = m_tail.load(memory_order_relaxed);
+		size_t room = m_mask + 1 - (tail - m_headCache);
+		if (room < n)
+		{
+			m_headCache = m_head.load(memory_order_acquire);
+			room = m_mask + 1 - (tail - m_headCache);
+		}
+		if (n > room)
+			n = room;
+
+		size_t i = 0;
+		try
+		{
+			for (; i < n; ++i, ++first)
+				::new (static_cast<void*>(m_slots + ((tail + i) & m_mask))) T(*first);
+		}
+		catch (...)
+		{
+			m_tail.store(tail + i, memory_order_release); // keep what was built
+			throw;
+		}
+		m_tail.store(tail + n, memory_order_release);
+		return n;
+	}
+
+	//-----------------------------------------------------------------------------
+	//    Class:			CRingQueue
+	//	  Method:			try_pop_bulk(OutputIt out, size_t n)
+	//
+	//	  Description:		consumer only; moves up to n elements to out, then
+	//						frees all their slots with a single store to m_head
+	//
+	//    Calls:            none
+	//    Called By:		n/a
+	//
+	//    Parameters:		OutputIt out, size_t n
+	//	  Return:			number of elements popped
+	//
+	//    History Log:
+	//                      10/17/2026 RD completed version
+	//-----------------------------------------------------------------------------
+
+	template <class T>
+	template <class OutputIt>
+	size_t CRingQueue<T>::try_pop_bulk(OutputIt out, size_t n)
+	{
+		size_t head = m_head.load(memory_order_relaxed);
+		size_t ready = m_tailCache - head;
+		if (ready < n)
+		{
+			m_tailCache = m_tail.load(memory_order_acquire);
+			ready = m_tailCache - head;
+		}
+		if (n > ready)
+			n = ready;
+
+		size_t i = 0;
+		try
+		{
+			for (; i < n; ++i, ++out)
+			{
+				T* slot = m_slots + ((head + i) & m_mask);
+				*out = std::move(*slot);
+				slot->~T();
+			}
+		}
+		catch (...)
+		{
+			m_head.store(head + i, memory_order_release);
+			throw;
+		}
+		m_head.store(head + n, memory_order_release);
+		return n;
+	}
+}
+
+#endif
@@ -0,0 +1,539 @@
+//-----------------------------------------------------------------------------
+//   File: Serialize.h
+//-----------------------------------------------------------------------------
+
+//-----------------------------------------------------------------------------
+//   Title: Binary save and load for list and CQueue
+//   Description: This file contains the versioned binary format for list
+//                and CQueue, and mapped_view for reading it in place
+//
+//   Programmer: Reinaldo Daniswara
+//
+//   Date: 10/17/2026
+//   Version: 1.0
+//
+//   Environment: Intel Core i7
+//     Software: MS Windows 10 for execution;
+//     Compiles under Microsoft Visual Studio 2015
+//
+//   File layout:
+//     list_file_header, 32 bytes, then zero padding up to payload_offset,
+//     then the elements front to back. When T is trivially copyable the
+//     payload is the elements' bytes back to back (flag contiguous) and
+//     payload_offset is a multiple of alignof(T), so the file can be
+//     mapped and read as an array. Any other T is written element by
+//     element through serializer<T>; strings are a 64-bit length followed
+//     by their characters. Integers are in host byte order and the header
+//     records it, so a file from a machine of the other order is refused.
+//
+//   struct serializer<T> -- write(ostream&, const T&), T read(istream&);
+//                           given for trivially copyable T and for strings,
+//                           specialize it for other element types
+//
+//   Functions:
+//     void save(ostream& out, const list<T>& x), save(ostream&, const CQueue<T>&)
+//     void load(istream& in, list<T>& x), load(istream&, CQueue<T>&) -- replace
+//                  the contents of x; x is unchanged if the stream is bad
+//     void save_file(const string& path, const C& x)
+//     void load_file(const string& path, C& x) -- maps the file for the
+//                  contiguous format, streams it otherwise
+//
+//   class mapped_view<T>:
+//     mapped_view(const string& path) -- maps a contiguous file read-only
+//     const T* begin(), end() const, size_t size() const, operator[](size_t)
+//
+//   History Log:
+//			10/17/2026 RD completed version 1.0
+//-----------------------------------------------------------------------------
+
+#ifndef SERIALIZE_H
+#define SERIALIZE_H
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <vector>
+#include "Queue.h"
+#ifdef _WIN32
+#include <iterator>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+using namespace std;
+
+namespace RD_ADT
+{
+
+	struct list_file_header
+	{
+		char magic[4];           // "RDLS"
+		uint16_t version;        // list_file_version when written
+		uint16_t flags;          // contiguous, ...
+		uint32_t byte_order;     // 0x01020304 as the writer stored it
+		uint32_t element_size;   // sizeof(T)
+		uint32_t payload_offset; // first element, from the start of the file
+		uint32_t reserved;
+		uint64_t count;          // number of elements
+	};
+
+	const uint16_t list_file_version = 1;
+	const uint16_t list_file_contiguous = 1;
+	const uint32_t list_file_byte_order = 0x01020304;
+
+	template <class T, class = void>
+	struct serializer; // no default, T needs a specialization
+
+	template <class T>
+	struct serializer<T, typename enable_if<is_trivially_copyable<T>::value>::type>
+	{
+		static void write(ostream& out, const T& x) { out.write(reinterpret_cast<const char*>(&x), sizeof(T)); }
+		static T read(istream& in)
+		{
+			typename aligned_storage<sizeof(T), alignof(T)>::type raw;
+			in.read(reinterpret_cast<char*>(&raw), sizeof(T));
+			return *reinterpret_cast<T*>(&raw);
+		}
+	};
+
+	template <class Char, class Traits, class A>
+	struct serializer<basic_string<Char, Traits, A> >
+	{
+		static void write(ostream& out, const basic_string<Char, Traits, A>& x)
+		{
+			uint64_t n = x.size();
+			out.write(reinterpret_cast<const char*>(&n), sizeof(n));
+			out.write(reinterpret_cast<const char*>(x.data()), n * sizeof(Char));
+		}
+		static basic_string<Char, Traits, A> read(istream& in)
+		{
+			uint64_t n = 0;
+			in.read(reinterpret_cast<char*>(&n), sizeof(n));
+			basic_string<Char, Traits, A> x;
+			if (!in)
+				return x;
+			if (n > x.max_size())
+				throw runtime_error("Truncated list file");
+			// grow only as characters arrive, so a corrupt length cannot
+			// allocate more than the stream really holds
+			const size_t chunk = 65536;
+			size_t have = 0;
+			while (have < n)
+			{
+				size_t step = static_cast<size_t>(n - have) < chunk ? static_cast<size_t>(n - have) : chunk;
+				x.resize(have + step);
+				if (!in.read(reinterpret_cast<char*>(&x[have]), step * sizeof(Char)))
+					throw runtime_error("Truncated list file");
+				have += step;
+			}
+			return x;
+		}
+	};
+
+	//-----------------------------------------------------------------------------
+	//	  Function:			make_header(size_t count)
+	//
+	//	  Description:		header for count elements of T
+	//
+	//    Parameters:		size_t count
+	//	  Return:			list_file_header
+	//
+	//    History Log:
+	//                      10/17/2026 RD completed version
+	//-----------------------------------------------------------------------------
+
+	template <class T>
+	list_file_header make_header(size_t count)
+	{
+		list_file_header h;
+		memcpy(h.magic, "RDLS", 4);
+		h.version = list_file_version;
+		h.flags = is_trivially_copyable<T>::value ? list_file_contiguous : 0;
+		h.byte_order = list_file_byte_order;
+		h.element_size = sizeof(T);
+		uint32_t offset = sizeof(list_file_header);
+		if (is_trivially_copyable<T>::value)
+			offset = (offset + alignof(T) - 1) / alignof(T) * alignof(T);
+		h.payload_offset = offset;
+		h.reserved = 0;
+		h.count = count;
+		return h;
+	}
+
+	//-----------------------------------------------------------------------------
+	//	  Function:			check_header(const list_file_header& h)
+	//
+	//	  Description:		throws unless h describes a file of T this build
+	//						can read
+	//
+	//    Parameters:		const list_file_header& h
+	//
+	//    History Log:
+	//                      10/17/2026 RD completed version
+	//-----------------------------------------------------------------------------
+
+	template <class T>
+	void check_header(const list_file_header& h)
+	{
+		if (memcmp(h.magic, "RDLS", 4) != 0)
+			throw runtime_error("Not a list file");
+		if (h.version == 0 || h.version > list_file_version)
+			throw runtime_error("Unsupported list file version");
+		if (h.byte_order != list_file_byte_order)
+			throw runtime_error("List file byte order differs");
+		bool contiguous = (h.flags & list_file_contiguous) != 0;
+		if (contiguous != is_trivially_copyable<T>::value || h.element_size != sizeof(T))
+			throw runtime_error("List file element type differs");
+		if (h.payload_offset < sizeof(list_file_header))
+			throw runtime_error("Bad list file");
+	}
+
+	//-----------------------------------------------------------------------------
+	//	  Function:			save_elements(ostream& out, It first, It last, size_t n)
+	//
+	//	  Description:		writes the header and the n elements of
+	//						[first, last). The contiguous format is gathered
+	//						into a 64 KB buffer and written a buffer at a time
+	//
+	//    Calls:            make_header(), serializer<T>::write()
+	//    Called By:		save()
+	//
+	//    Parameters:		ostream& out, It first, It last, size_t n
+	//
+	//    History Log:
+	//                      10/17/2026 RD completed version
+	//                      10/17/2026 RD compile-time format choice
+	//-----------------------------------------------------------------------------
+
+	template <class T, class It>
+	void save_elements(ostream& out, It first, It last, size_t n)
+	{
+		list_file_header h = make_header<T>(n);
+		out.write(reinterpret_cast<const char*>(&h), sizeof(h));
+		for (size_t pad = h.payload_offset - sizeof(h); pad > 0; pad--)
+			out.put('\0');
+
+		if constexpr (is_trivially_copyable<T>::value)
+		{
+			const size_t per_buffer = sizeof(T) < 65536 ? 65536 / sizeof(T) : 1;
+			vector<char> buffer(per_buffer * sizeof(T));
+			size_t used = 0;
+			for (; first != last; ++first)
+			{
+				memcpy(&buffer[used * sizeof(T)], &*first, sizeof(T));
+				if (++used == per_buffer)
+				{
+					out.write(buffer.data(), used * sizeof(T));
+					used = 0;
+				}
+			}
+			out.write(buffer.data(), used * sizeof(T));
+		}
+		else
+		{
+			for (; first != last; ++first)
+				serializer<T>::write(out, *first);
+		}
+		if (!out)
+			throw runtime_error("List file write failed");
+	}
+
+	//-----------------------------------------------------------------------------
+	//	  Function:			load_elements(istream& in, list<T>& x)
+	//
+	//	  Description:		reads a header and its elements onto the back of
+	//						x. The contiguous format is read 64 KB at a time
+	//						straight into raw storage for T; each buffer is
+	//						built into one chain of cells by the range
+	//						constructor and spliced onto x in O(1)
+	//
+	//    Calls:            check_header(), serializer<T>::read(),
+	//						list(InputIt, InputIt), splice()
+	//    Called By:		load()
+	//
+	//    Parameters:		istream& in, list<T>& x -- empty
+	//
+	//    History Log:
+	//                      10/17/2026 RD completed version
+	//                      10/17/2026 RD compile-time format choice, one chain per buffer
+	//-----------------------------------------------------------------------------
+
+	template <class T, class Alloc, class Stats>
+	void load_elements(istream& in, list<T, Alloc, Stats>& x)
+	{
+		list_file_header h;
+		if (!in.read(reinterpret_cast<char*>(&h), sizeof(h)))
+			throw runtime_error("Truncated list file");
+		check_header<T>(h);
+		in.ignore(h.payload_offset - sizeof(h));
+
+		if constexpr (is_trivially_copyable<T>::value)
+		{
+			const size_t per_buffer = sizeof(T) < 65536 ? 65536 / sizeof(T) : 1;
+			vector<typename aligned_storage<sizeof(T), alignof(T)>::type> buffer(per_buffer);
+			const T* elements = reinterpret_cast<const T*>(buffer.data());
+			for (uint64_t left = h.count; left > 0;)
+			{
+				size_t n = left < per_buffer ? static_cast<size_t>(left) : per_buffer;
+				if (!in.read(reinterpret_cast<char*>(buffer.data()), n * sizeof(T)))
+					throw runtime_error("Truncated list file");
+				list<T, Alloc, Stats> chunk(elements, elements + n);
+				x.splice(x.end(), chunk);
+				left -= n;
+			}
+		}
+		else
+		{
+			for (uint64_t i = 0; i < h.count; i++)
+			{
+				T datum = serializer<T>::read(in);
+				if (!in)
+					throw runtime_error("Truncated list file");
+				x.push_back(std::move(datum));
+			}
+		}
+	}
+
+	//-----------------------------------------------------------------------------
+	//	  Function:			save(ostream& out, const list<T>& x)
+	//						save(ostream& out, const CQueue<T>& x)
+	//
+	//	  Description:		writes x front to back in the binary format
+	//
+	//    Calls:            save_elements()
+	//
+	//    Parameters:		ostream& out -- opened in binary mode, x
+	//
+	//    History Log:
+	//                      10/17/2026 RD completed version
+	//-----------------------------------------------------------------------------
+
+	template <class T, class Alloc, class Stats>
+	void save(ostream& out, const list<T, Alloc, Stats>& x)
+	{
+		save_elements<T>(out, x.begin(), x.end(), x.getSize());
+	}
+
+	template <class T, class Alloc, class Stats>
+	void save(ostream& out, const CQueue<T, Alloc, Stats>& x)
+	{
+		save_elements<T>(out, x.begin(), x.end(), x.getSize());
+	}
+
+	//-----------------------------------------------------------------------------
+	//	  Function:			load(istream& in, list<T>& x)
+	//						load(istream& in, CQueue<T>& x)
+	//
+	//	  Description:		replaces the contents of x with the list read
+	//						from in; a queue gets the loaded cells relinked
+	//						onto it in one step
+	//
+	//    Calls:            load_elements(), CQueue::push_bulk()
+	//
+	//    Parameters:		istream& in -- opened in binary mode, x
+	//
+	//    History Log:
+	//                      10/17/2026 RD completed version
+	//-----------------------------------------------------------------------------
+
+	template <class T, class Alloc, class Stats>
+	void load(istream& in, list<T, Alloc, Stats>& x)
+	{
+		list<T, Alloc, Stats> loaded;
+		load_elements(in, loaded);
+		x = std::move(loaded);
+	}
+
+	template <class T, class Alloc, class Stats>
+	void load(istream& in, CQueue<T, Alloc, Stats>& x)
+	{
+		list<T, Alloc, Stats> loaded;
+		load_elements(in, loaded);
+		x.release();
+		x.push_bulk(std::move(loaded));
+	}
+
+	//-----------------------------------------------------------------------------
+	//    Class:			mapped_view<T>
+	//
+	//	  Description:		read-only mapping of a contiguous list file; the
+	//						elements are used in place, no copy is made. On
+	//						Windows the payload is read into memory instead
+	//
+	//    History Log:
+	//                      10/17/2026 RD completed version
+	//-----------------------------------------------------------------------------
+
+	template <class T>
+	class mapped_view
+	{
+		static_assert(is_trivially_copyable<T>::value, "mapped_view needs a trivially copyable T");
+	public:
+		explicit mapped_view(const string& path);
+		mapped_view(const mapped_view&) = delete;
+		mapped_view& operator=(const mapped_view&) = delete;
+		~mapped_view()
+		{
+#ifndef _WIN32
+			if (m_base != nullptr)
+				munmap(m_base, m_length);
+#endif
+		}
+
+		size_t size() const { return m_count; }
+		const T* begin() const { return m_data; }
+		const T* end() const { return m_data + m_count; }
+		const T& operator[](size_t i) const { return m_data[i]; }
+
+	private:
+		const T* m_data;
+		size_t m_count;
+#ifdef _WIN32
+		vector<char> m_bytes;
+#else
+		void* m_base;    // start of the mapping
+		size_t m_length; // bytes mapped
+#endif
+	};
+
+	//-----------------------------------------------------------------------------
+	//    Class:			mapped_view<T>
+	//	  Method:			mapped_view(const string& path)
+	//
+	//	  Description:		maps path, checks the header and that the file
+	//						holds every element it claims
+	//
+	//    Calls:            check_header()
+	//    Called By:		load_file()
+	//
+	//    Parameters:		const string& path
+	//
+	//    History Log:
+	//                      10/17/2026 RD completed version
+	//-----------------------------------------------------------------------------
+
+	template <class T>
+	mapped_view<T>::mapped_view(const string& path)
+		: m_data(nullptr), m_count(0)
+#ifndef _WIN32
+		, m_base(nullptr), m_length(0)
+#endif
+	{
+		const char* bytes;
+		size_t length;
+#ifdef _WIN32
+		ifstream in(path, ios::binary);
+		if (!in)
+			throw runtime_error("Cannot open " + path);
+		m_bytes.assign(istreambuf_iterator<char>(in), istreambuf_iterator<char>());
+		bytes = m_bytes.data();
+		length = m_bytes.size();
+#else
+		int fd = open(path.c_str(), O_RDONLY);
+		if (fd < 0)
+			throw runtime_error("Cannot open " + path);
+		struct stat st;
+		if (fstat(fd, &st) != 0 || st.st_size < static_cast<off_t>(sizeof(list_file_header)))
+		{
+			close(fd);
+			throw runtime_error("Truncated list file");
+		}
+		length = static_cast<size_t>(st.st_size);
+		void* base = mmap(nullptr, length, PROT_READ, MAP_PRIVATE, fd, 0);
+		close(fd);
+		if (base == MAP_FAILED)
+			throw runtime_error("Cannot map " + path);
+		bytes = static_cast<const char*>(base);
+#endif
+		list_file_header h;
+		try
+		{
+			if (length < sizeof(list_file_header))
+				throw runtime_error("Truncated list file");
+			memcpy(&h, bytes, sizeof(h));
+			check_header<T>(h);
+			if (h.payload_offset > length || (length - h.payload_offset) / sizeof(T) < h.count)
+				throw runtime_error("Truncated list file");
+		}
+		catch (...)
+		{
+#ifndef _WIN32
+			munmap(base, length); // the destructor does not run for a half-built view
+#endif
+			throw;
+		}
+#ifndef _WIN32
+		m_base = base;
+		m_length = length;
+		madvise(base, length, MADV_SEQUENTIAL);
+#endif
+		m_data = reinterpret_cast<const T*>(bytes + h.payload_offset);
+		m_count = static_cast<size_t>(h.count);
+	}
+
+	//-----------------------------------------------------------------------------
+	//	  Function:			save_file(const string& path, const C& x)
+	//
+	//	  Description:		writes x to path, replacing the file
+	//
+	//    Calls:            save()
+	//
+	//    Parameters:		const string& path, const C& x -- list or CQueue
+	//
+	//    History Log:
+	//                      10/17/2026 RD completed version
+	//-----------------------------------------------------------------------------
+
+	template <class C>
+	void save_file(const string& path, const C& x)
+	{
+		ofstream out(path, ios::binary | ios::trunc);
+		if (!out)
+			throw runtime_error("Cannot open " + path);
+		save(out, x);
+		out.close();
+		if (!out)
+			throw runtime_error("List file write failed");
+	}
+
+	//-----------------------------------------------------------------------------
+	//	  Function:			load_file(const string& path, C& x)
+	//
+	//	  Description:		replaces the contents of x with the list in path.
+	//						The contiguous format is mapped and its elements
+	//						copied straight out of the page cache
+	//
+	//    Calls:            mapped_view, load()
+	//
+	//    Parameters:		const string& path, C& x -- list or CQueue
+	//
+	//    History Log:
+	//                      10/17/2026 RD completed version
+	//-----------------------------------------------------------------------------
+
+	template <class C>
+	void load_file(const string& path, C& x)
+	{
+		typedef typename C::value_type T;
+		if constexpr (is_trivially_copyable<T>::value)
+		{
+			mapped_view<T> view(path);
+			C loaded(view.begin(), view.end());
+			x = std::move(loaded);
+		}
+		else
+		{
+			ifstream in(path, ios::binary);
+			if (!in)
+				throw runtime_error("Cannot open " + path);
+			load(in, x);
+		}
+	}
+}
+
+#endif
@@ -0,0 +1,138 @@
+//-----------------------------------------------------------------------------
+//   File: SmallBuffer.h
+//-----------------------------------------------------------------------------
+
+//-----------------------------------------------------------------------------
+//   Title: inline_allocator Class
+//   Description: This file contains the small buffer allocator that keeps
+//                the first cells of a container inside the container
+//
+//   Programmer: Reinaldo Daniswara
+//
+//   Date: 10/17/2026
+//   Version: 1.0
+//
+//   Environment: Intel Core i7
+//     Software: MS Windows 10 for execution;
+//     Compiles under Microsoft Visual Studio 2015
+//
+//   class inline_allocator<T, N>:
+//
+//     Standard allocator holding room for N objects inside itself. Single
+//     objects come from that room while it lasts and from pool_allocator
+//     after that, so a container that stays at N elements or fewer never
+//     touches the heap. Freed inline cells go onto a free list of their own.
+//
+//     Cells live inside the allocator, so every instance is a separate
+//     arena: a copy, a move or a rebind starts out empty, assignment keeps
+//     the arena it has, and two instances compare equal only if they are
+//     the same object. Containers must therefore move elements, not cells,
+//     between two instances (list does), and moving the container moves
+//     its elements one by one and invalidates its iterators.
+//
+//     Properties:
+//       cell m_cells[N] -- the inline room
+//       cell* m_free -- inline cells freed and not yet reused
+//       size_t m_used -- inline cells handed out at least once
+//
+//     Methods:
+//
+//       inline:
+//         inline_allocator() -- an empty arena
+//         inline_allocator(const inline_allocator<U, N>&) -- an empty arena
+//         T* allocate(size_t n) -- an inline cell if n is 1 and one is free
+//         void deallocate(T* p, size_t n) -- back to the arena or the pool
+//         bool owns(const T* p)const -- true if p is one of the inline cells
+//
+//   History Log:
+//			10/17/2026 RD completed version 1.0
+//-----------------------------------------------------------------------------
+
+#ifndef SMALL_BUFFER_H
+#define SMALL_BUFFER_H
+#include <cstddef>
+#include <functional>
+#include <type_traits>
+#include "Pool.h"
+
+using namespace std;
+
+namespace RD_ADT
+{
+
+	template <class T, size_t N>
+	class inline_allocator
+	{
+		static_assert(N > 0, "inline_allocator needs room for at least one cell");
+	public:
+		typedef T value_type;
+		typedef false_type is_always_equal;
+		typedef false_type propagate_on_container_copy_assignment;
+		typedef false_type propagate_on_container_move_assignment;
+		typedef false_type propagate_on_container_swap;
+		template <class U>
+		struct rebind { typedef inline_allocator<U, N> other; };
+
+		inline_allocator() : m_free(nullptr), m_used(0) {}
+		inline_allocator(const inline_allocator&) : m_free(nullptr), m_used(0) {}
+		template <class U>
+		inline_allocator(const inline_allocator<U, N>&) : m_free(nullptr), m_used(0) {}
+		inline_allocator& operator=(const inline_allocator&) { return *this; } // keeps its own cells
+
+		T* allocate(size_t n)
+		{
+			if (n == 1)
+			{
+				if (m_free != nullptr)
+				{
+					cell* c = m_free;
+					m_free = c->next;
+					return reinterpret_cast<T*>(c);
+				}
+				if (m_used < N)
+					return reinterpret_cast<T*>(&m_cells[m_used++]);
+			}
+			return pool_allocator<T>().allocate(n);
+		}
+
+		void deallocate(T* p, size_t n)
+		{
+			if (owns(p))
+			{
+				cell* c = reinterpret_cast<cell*>(p);
+				c->next = m_free;
+				m_free = c;
+			}
+			else
+				pool_allocator<T>().deallocate(p, n);
+		}
+
+		bool owns(const T* p) const
+		{
+			const T* first = reinterpret_cast<const T*>(&m_cells[0]);
+			const T* last = reinterpret_cast<const T*>(&m_cells[N]);
+			return !less<const T*>()(p, first) && less<const T*>()(p, last);
+		}
+
+	private:
+		union cell
+		{
+			cell* next; // while on m_free
+			alignas(T) unsigned char datum[sizeof(T)];
+		};
+
+		cell m_cells[N];
+		cell* m_free;
+		size_t m_used;
+	};
+
+	template <class T, class U, size_t N>
+	bool operator==(const inline_allocator<T, N>& a, const inline_allocator<U, N>& b)
+	{
+		return static_cast<const void*>(&a) == static_cast<const void*>(&b);
+	}
+	template <class T, class U, size_t N>
+	bool operator!=(const inline_allocator<T, N>& a, const inline_allocator<U, N>& b) { return !(a == b); }
+}
+
+#endif
@@ -0,0 +1,519 @@
+//-----------------------------------------------------------------------------
+//   File: SpillQueue.h
+//-----------------------------------------------------------------------------
+
+//-------------------------------------------------------------------------------------------
+//    Class:			CSpillQueue
+//
+//    File:             SpillQueue.h
+//
+//    Title:            CSpillQueue Class
+//
+//    Description:		This file contains the class definition for
+//						CSpillQueue, a CQueue that keeps a bounded number
+//						of elements in memory and spills the rest to
+//						segment files on local disk
+//
+//    Programmer:		Reinaldo Daniswara
+//
+//    Date:             10/17/2026
+//
+//    Version:          1.0
+//
+//   Environment:		Intel COre i7
+//						Software: MS Windows 10 for execution;
+//						Compiles under Microsoft Visual Studio 2015
+//
+//	  class CSpillQueue<T>:
+//
+//	  The queue is three parts, oldest first: a head CQueue that pops come
+//	  from, a run of segment files, and a tail CQueue that pushes go to.
+//	  Each part in memory holds fewer than budget / 2 elements, or up to
+//	  budget / 2 for the head, so no more than budget elements are ever in
+//	  memory. While nothing is on disk a full tail feeds the head first;
+//	  otherwise the whole tail is written out as a new segment, once, front
+//	  to back, in the list file format of Serialize.h. When the head runs
+//	  dry the oldest segment is read back in one sequential pass, mapped for
+//	  trivially copyable T and streamed otherwise, and its file deleted.
+//	  Segments are written under a temporary name and renamed, so a crash
+//	  never leaves half a segment behind. A segment left by a queue with a
+//	  larger budget may hold more than budget / 2 elements; before it is
+//	  read it is split on disk, a chunk of budget / 2 at a time, into
+//	  segments numbered just in front of it, so the budget holds for any
+//	  directory.
+//
+//	  Segments are named by a sequence number, so a queue built on the
+//	  same directory after a restart picks up where the last one left off.
+//	  The destructor persists the head and tail as segments of their own,
+//	  so a normal shutdown loses nothing; after a crash only the elements
+//	  that had been spilled are recovered, and a segment read in just
+//	  before the crash may be delivered again. Files are not fsynced. T
+//	  needs a serializer<T> (see Serialize.h). Like CQueue, a CSpillQueue
+//	  is not thread safe, and only one may use a directory at a time.
+//
+//	  Methods:
+//
+//		inline:
+//		bool empty() const -- true if no element is queued anywhere
+//		size_t size() const -- elements queued, in memory and on disk
+//		size_t in_memory() const -- elements held in memory
+//		size_t spilled() const -- elements held on disk
+//		size_t segments() const -- segment files held
+//		size_t budget() const -- most elements held in memory
+//		void push(const T& x), push(T&& x) -- forward to emplace
+//
+//		non-inline:
+//		CSpillQueue(const string& directory, size_t budget) -- creates
+//				directory if needed and takes over the segments in it;
+//				throws out_of_range for a budget below 2
+//		~CSpillQueue() -- persist(); errors are swallowed
+//		void emplace(Args&&... args) -- adds an element at the tail
+//		T pop() -- removes the oldest element; throws runtime_error if empty
+//		void persist() -- writes the head and tail out as segments
+//		void release() -- drops every element and deletes every segment
+//
+//		private:
+//		void spill() -- writes the tail out as the newest segment
+//		void refill() -- reads the oldest segment or the tail into the head
+//		void split_oldest() -- rewrites the oldest segment as ones of budget / 2
+//		string segment_path(uint64_t seq) const -- file for a segment
+//		void write_segment(uint64_t seq, CQueue<T>& part) -- writes and empties part
+//
+//    History Log:
+//                           10/17/2026  RD  completed version 1.0
+//                           10/17/2026  RD  oversized segments split, budget of at least 2
+// ----------------------------------------------------------------------------
+
+#ifndef SPILL_QUEUE_H
+#define SPILL_QUEUE_H
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+#include "Queue.h"
+#include "Serialize.h"
+
+using namespace std;
+
+namespace RD_ADT
+{
+	template <class T>
+	class CSpillQueue
+	{
+	public:
+		CSpillQueue(const string& directory, size_t budget);
+		CSpillQueue(const CSpillQueue&) = delete;
+		CSpillQueue& operator=(const CSpillQueue&) = delete;
+		~CSpillQueue()
+		{
+			try { persist(); }
+			catch (...) {} // the spilled segments are still there
+		}
+
+		bool empty() const { return size() == 0; }
+		size_t size() const { return m_head.getSize() + m_spilled + m_tail.getSize(); }
+		size_t in_memory() const { return m_head.getSize() + m_tail.getSize(); }
+		size_t spilled() const { return m_spilled; }
+		size_t segments() const { return m_segments.getSize(); }
+		size_t budget() const { return m_budget; }
+
+		void push(const T& x) { emplace(x); }
+		void push(T&& x) { emplace(std::move(x)); }
+		template <class... Args>
+		void emplace(Args&&... args);
+		T pop();
+		void persist();
+		void release();
+
+	private:
+		typedef pair<uint64_t, size_t> segment; // sequence number, element count
+
+		void spill();
+		void refill();
+		void split_oldest();
+		string segment_path(uint64_t seq) const;
+		void write_segment(uint64_t seq, CQueue<T>& part);
+
+		string m_directory;
+		size_t m_budget; // most elements in memory
+		size_t m_half; // most elements in the head, the tail spills at this size
+		CQueue<T> m_head; // oldest elements, popped first
+		CQueue<segment> m_segments; // on disk, oldest first
+		size_t m_spilled; // elements in m_segments
+		CQueue<T> m_tail; // newest elements, pushed last
+		uint64_t m_first; // sequence number of the oldest segment
+		uint64_t m_next; // sequence number for the next spill
+	};
+
+	//-----------------------------------------------------------------------------
+	//    Class:			CSpillQueue
+	//	  Method:			CSpillQueue(const string& directory, size_t budget)
+	//
+	//	  Description:		creates directory if it is missing, deletes
+	//						half written segments and queues the complete
+	//						ones in sequence order; an empty directory starts
+	//						numbering in the middle of the range, so a head
+	//						can always be persisted in front of the oldest
+	//
+	//    Calls:            check_header(), segment_path()
+	//    Called By:		main
+	//
+	//    Parameters:		const string& directory, size_t budget -- most
+	//						elements held in memory
+	//
+	//    History Log:
+	//                      10/17/2026 RD completed version
+	//-----------------------------------------------------------------------------
+
+	template <class T>
+	CSpillQueue<T>::CSpillQueue(const string& directory, size_t budget)
+		: m_directory(directory), m_budget(budget), m_half(budget / 2),
+		m_spilled(0), m_first(uint64_t(1) << 62), m_next(uint64_t(1) << 62)
+	{
+		if (budget < 2)
+			throw out_of_range("Budget below 2"); // the head and tail need one element each
+		filesystem::create_directories(directory);
+
+		vector<uint64_t> found;
+		vector<filesystem::path> partial;
+		for (const filesystem::directory_entry& entry : filesystem::directory_iterator(directory))
+		{
+			string name = entry.path().filename().string();
+			if (entry.path().extension() == ".tmp")
+				partial.push_back(entry.path());
+			else if (entry.path().extension() == ".seg" && name.size() == 20)
+				found.push_back(stoull(name.substr(0, 16), nullptr, 16));
+		}
+		for (const filesystem::path& path : partial)
+			filesystem::remove(path);
+		sort(found.begin(), found.end());
+		for (uint64_t seq : found)
+		{
+			ifstream in(segment_path(seq), ios::binary);
+			list_file_header h;
+			if (!in.read(reinterpret_cast<char*>(&h), sizeof(h)))
+				throw runtime_error("Truncated list file");
+			check_header<T>(h);
+			m_segments.push(segment(seq, static_cast<size_t>(h.count)));
+			m_spilled += static_cast<size_t>(h.count);
+		}
+		if (!found.empty())
+		{
+			m_first = found.front();
+			m_next = found.back() + 1;
+		}
+	}
+
+	//-----------------------------------------------------------------------------
+	//    Class:			CSpillQueue
+	//	  Method:			emplace(Args&&... args)
+	//
+	//	  Description:		adds an element at the tail. A tail grown to half
+	//						the budget first tops the head up, if nothing is
+	//						on disk between them, and is spilled if still full
+	//
+	//    Calls:            CQueue::emplace(), CQueue::push_bulk(), spill()
+	//    Called By:		push(), main
+	//
+	//    Parameters:		Args&&... args
+	//
+	//    History Log:
+	//                      10/17/2026 RD completed version
+	//-----------------------------------------------------------------------------
+
+	template <class T>
+	template <class... Args>
+	void CSpillQueue<T>::emplace(Args&&... args)
+	{
+		m_tail.emplace(std::forward<Args>(args)...);
+		if (m_tail.getSize() < m_half)
+			return;
+		if (m_segments.empty() && m_head.getSize() < m_half)
+			m_head.push_bulk(m_tail.pop_bulk(m_half - m_head.getSize()));
+		if (m_tail.getSize() >= m_half)
+			spill();
+	}
+
+	//-----------------------------------------------------------------------------
+	//    Class:			CSpillQueue
+	//	  Method:			pop()
+	//
+	//	  Description:		removes the oldest element, refilling an empty
+	//						head first
+	//	  Return:			the element, moved out
+	//
+	//    Calls:            refill(), CQueue::pop()
+	//    Called By:		main
+	//
+	//    Parameters:		none
+	//
+	//    History Log:
+	//                      10/17/2026 RD completed version
+	//-----------------------------------------------------------------------------
+
+	template <class T>
+	T CSpillQueue<T>::pop()
+	{
+		if (m_head.empty())
+			refill();
+		return m_head.pop(); // throws "Empty list" if the tail was empty too
+	}
+
+	//-----------------------------------------------------------------------------
+	//    Class:			CSpillQueue
+	//	  Method:			spill()
+	//
+	//	  Description:		writes the whole tail out as the newest segment
+	//
+	//    Calls:            write_segment()
+	//    Called By:		emplace()
+	//
+	//    Parameters:		none
+	//
+	//    History Log:
+	//                      10/17/2026 RD completed version
+	//-----------------------------------------------------------------------------
+
+	template <class T>
+	void CSpillQueue<T>::spill()
+	{
+		size_t n = m_tail.getSize();
+		write_segment(m_next, m_tail);
+		if (m_segments.empty())
+			m_first = m_next;
+		m_segments.push(segment(m_next++, n));
+		m_spilled += n;
+	}
+
+	//-----------------------------------------------------------------------------
+	//    Class:			CSpillQueue
+	//	  Method:			refill()
+	//
+	//	  Description:		reads the oldest segment into the empty head and
+	//						deletes its file, splitting it first if it holds
+	//						more than the head may, or with nothing on disk
+	//						moves the tail into the head
+	//
+	//    Calls:            split_oldest(), load_file(), segment_path(),
+	//						CQueue::push_bulk()
+	//    Called By:		pop()
+	//
+	//    Parameters:		none
+	//
+	//    History Log:
+	//                      10/17/2026 RD completed version
+	//-----------------------------------------------------------------------------
+
+	template <class T>
+	void CSpillQueue<T>::refill()
+	{
+		if (m_segments.empty())
+		{
+			m_head.push_bulk(m_tail.pop_bulk(m_tail.getSize()));
+			return;
+		}
+		if (m_segments.begin()->second > m_half)
+			split_oldest();
+		segment oldest = *m_segments.begin();
+		string path = segment_path(oldest.first);
+		load_file(path, m_head);
+		m_segments.pop();
+		m_spilled -= oldest.second;
+		m_first = oldest.first + 1;
+		filesystem::remove(path);
+	}
+
+	//-----------------------------------------------------------------------------
+	//    Class:			CSpillQueue
+	//	  Method:			split_oldest()
+	//
+	//	  Description:		rewrites the oldest segment as segments of at most
+	//						half the budget, numbered in front of it, and
+	//						deletes it. Only one chunk is in memory at a time
+	//						and the head is empty, so the budget holds. A
+	//						crash part way leaves the chunks written so far
+	//						as well as the original, which repeats elements
+	//						but loses none
+	//
+	//    Calls:            mapped_view, check_header(), serializer<T>::read(),
+	//						write_segment(), segment_path()
+	//    Called By:		refill()
+	//
+	//    Parameters:		none
+	//
+	//    History Log:
+	//                      10/17/2026 RD completed version
+	//-----------------------------------------------------------------------------
+
+	template <class T>
+	void CSpillQueue<T>::split_oldest()
+	{
+		segment oldest = *m_segments.begin();
+		size_t chunks = (oldest.second + m_half - 1) / m_half;
+		uint64_t seq = oldest.first - chunks;
+		string path = segment_path(oldest.first);
+		CQueue<segment> reordered;
+		if constexpr (is_trivially_copyable<T>::value)
+		{
+			mapped_view<T> view(path);
+			for (size_t from = 0; from < view.size(); from += m_half)
+			{
+				CQueue<T> part(view.begin() + from, view.begin() + min(view.size(), from + m_half));
+				size_t n = part.getSize();
+				write_segment(seq + reordered.getSize(), part);
+				reordered.push(segment(seq + reordered.getSize(), n));
+			}
+		}
+		else
+		{
+			ifstream in(path, ios::binary);
+			list_file_header h;
+			if (!in.read(reinterpret_cast<char*>(&h), sizeof(h)))
+				throw runtime_error("Truncated list file");
+			check_header<T>(h);
+			in.ignore(h.payload_offset - sizeof(h));
+			for (uint64_t left = h.count; left > 0;)
+			{
+				size_t n = left < m_half ? static_cast<size_t>(left) : m_half;
+				CQueue<T> part;
+				for (size_t i = 0; i < n; i++)
+				{
+					T datum = serializer<T>::read(in);
+					if (!in)
+						throw runtime_error("Truncated list file");
+					part.push(std::move(datum));
+				}
+				write_segment(seq + reordered.getSize(), part);
+				reordered.push(segment(seq + reordered.getSize(), n));
+				left -= n;
+			}
+		}
+		m_segments.pop();
+		while (!m_segments.empty())
+			reordered.push(m_segments.pop());
+		m_segments = std::move(reordered);
+		m_first = seq;
+		filesystem::remove(path);
+	}
+
+	//-----------------------------------------------------------------------------
+	//    Class:			CSpillQueue
+	//	  Method:			persist()
+	//
+	//	  Description:		writes the head out in front of the oldest
+	//						segment and the tail after the newest, leaving
+	//						nothing in memory; every element is then on disk
+	//
+	//    Calls:            write_segment()
+	//    Called By:		~CSpillQueue(), main
+	//
+	//    Parameters:		none
+	//
+	//    History Log:
+	//                      10/17/2026 RD completed version
+	//-----------------------------------------------------------------------------
+
+	template <class T>
+	void CSpillQueue<T>::persist()
+	{
+		if (!m_tail.empty())
+			spill();
+		if (!m_head.empty())
+		{
+			size_t n = m_head.getSize();
+			uint64_t seq = m_segments.empty() ? m_next++ : m_first - 1;
+			write_segment(seq, m_head);
+			CQueue<segment> reordered;
+			reordered.push(segment(seq, n));
+			while (!m_segments.empty())
+				reordered.push(m_segments.pop());
+			m_segments = std::move(reordered);
+			m_first = seq;
+			m_spilled += n;
+		}
+	}
+
+	//-----------------------------------------------------------------------------
+	//    Class:			CSpillQueue
+	//	  Method:			release()
+	//
+	//	  Description:		drops every element in memory and deletes every
+	//						segment file
+	//
+	//    Calls:            segment_path()
+	//    Called By:		main
+	//
+	//    Parameters:		none
+	//
+	//    History Log:
+	//                      10/17/2026 RD completed version
+	//-----------------------------------------------------------------------------
+
+	template <class T>
+	void CSpillQueue<T>::release()
+	{
+		m_head.release();
+		m_tail.release();
+		while (!m_segments.empty())
+			filesystem::remove(segment_path(m_segments.pop().first));
+		m_spilled = 0;
+	}
+
+	//-----------------------------------------------------------------------------
+	//    Class:			CSpillQueue
+	//	  Method:			segment_path(uint64_t seq)
+	//
+	//	  Description:		path of segment seq: 16 hex digits, so names
+	//						sort in sequence order, and ".seg"
+	//	  Return:			the path
+	//
+	//    Calls:            none
+	//    Called By:		most methods
+	//
+	//    Parameters:		uint64_t seq
+	//
+	//    History Log:
+	//                      10/17/2026 RD completed version
+	//-----------------------------------------------------------------------------
+
+	template <class T>
+	string CSpillQueue<T>::segment_path(uint64_t seq) const
+	{
+		char name[24];
+		snprintf(name, sizeof(name), "%016llx.seg", static_cast<unsigned long long>(seq));
+		return (filesystem::path(m_directory) / name).string();
+	}
+
+	//-----------------------------------------------------------------------------
+	//    Class:			CSpillQueue
+	//	  Method:			write_segment(uint64_t seq, CQueue<T>& part)
+	//
+	//	  Description:		writes part, front to back, to a temporary file,
+	//						renames it to segment seq, then empties part
+	//
+	//    Calls:            save_file(), segment_path()
+	//    Called By:		spill(), persist()
+	//
+	//    Parameters:		uint64_t seq, CQueue<T>& part
+	//
+	//    History Log:
+	//                      10/17/2026 RD completed version
+	//-----------------------------------------------------------------------------
+
+	template <class T>
+	void CSpillQueue<T>::write_segment(uint64_t seq, CQueue<T>& part)
+	{
+		string path = segment_path(seq);
+		string temp = path.substr(0, path.size() - 4) + ".tmp";
+		save_file(temp, part);
+		filesystem::rename(temp, path);
+		part.release();
+	}
+}
+
+#endif
@@ -0,0 +1,239 @@
+//-----------------------------------------------------------------------------
+//   File: ThreadPool.h
+//-----------------------------------------------------------------------------
+
+//-----------------------------------------------------------------------------
+//   Title: thread_pool Class
+//   Description: This file contains the fixed set of worker threads the
+//                parallel algorithms run on
+//
+//   Programmer: Reinaldo Daniswara
+//
+//   Date: 10/17/2026
+//   Version: 1.0
+//
+//   Environment: Intel Core i7
+//     Software: MS Windows 10 for execution;
+//     Compiles under Microsoft Visual Studio 2015
+//
+//   class thread_pool:
+//
+//     Starts its workers once and keeps them parked on a condition variable
+//     until a task is queued. Tasks wait in a CQueue guarded by one mutex;
+//     the queue uses std::allocator because its cells are freed on a
+//     different thread than the one that allocated them, which would drain
+//     one thread's node_pool into another's. run(n, f) is a fork/join: the
+//     calling thread works alongside the workers and only returns once every
+//     f(i) has finished, rethrowing the first exception any of them threw.
+//     run waits on helper tasks, so it must not be called from inside a
+//     task on the same pool. Submitted tasks must not throw.
+//
+//     Methods:
+//
+//       inline:
+//         thread_pool(unsigned workers) -- starts workers threads, one less
+//                                          than the core count by default
+//         ~thread_pool() -- finishes queued tasks and joins the workers
+//         unsigned size() const -- number of workers
+//         static unsigned default_workers() -- cores minus the caller
+//
+//       non-inline:
+//         void submit(function<void()> task) -- queue a task, fire and forget
+//         void run(size_t n, F f) -- calls f(0) .. f(n - 1) on the workers
+//                                    and the caller, returns when all are done
+//         void work() -- private, worker thread loop
+//
+//   History Log:
+//			10/17/2026 RD completed version 1.0
+//-----------------------------------------------------------------------------
+
+#ifndef THREAD_POOL_H
+#define THREAD_POOL_H
+#include <atomic>
+#include <condition_variable>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include "Queue.h"
+
+using namespace std;
+
+namespace RD_ADT
+{
+
+	class thread_pool
+	{
+	public:
+		explicit thread_pool(unsigned workers = default_workers()) : m_stop(false)
+		{
+			m_threads.reserve(workers);
+			for (unsigned i = 0; i < workers; i++)
+				m_threads.emplace_back([this]() { work(); });
+		}
+		thread_pool(const thread_pool&) = delete;
+		thread_pool& operator=(const thread_pool&) = delete;
+		~thread_pool()
+		{
+			{
+				lock_guard<mutex> guard(m_lock);
+				m_stop = true;
+			}
+			m_wake.notify_all();
+			for (thread& t : m_threads)
+				t.join();
+		}
+
+		unsigned size() const { return static_cast<unsigned>(m_threads.size()); }
+		static unsigned default_workers()
+		{
+			unsigned cores = thread::hardware_concurrency();
+			return cores > 1 ? cores - 1 : 0;
+		}
+
+		void submit(function<void()> task);
+		template <class F>
+		void run(size_t n, F f);
+
+	private:
+		void work();
+
+		mutex m_lock; // guards m_tasks and m_stop
+		condition_variable m_wake;
+		CQueue<function<void()>, allocator<function<void()> > > m_tasks;
+		bool m_stop;
+		vector<thread> m_threads;
+	};
+
+	//-----------------------------------------------------------------------------
+	//    Class:			thread_pool
+	//	  Method:			submit(function<void()> task)
+	//
+	//	  Description:		queues task and wakes one worker
+	//
+	//    Calls:            CQueue::push()
+	//    Called By:		run(), callers
+	//
+	//    Parameters:		function<void()> task
+	//
+	//    History Log:
+	//                      10/17/2026 RD completed version
+	//-----------------------------------------------------------------------------
+
+	inline void thread_pool::submit(function<void()> task)
+	{
+		{
+			lock_guard<mutex> guard(m_lock);
+			m_tasks.push(std::move(task));
+		}
+		m_wake.notify_one();
+	}
+
+	//-----------------------------------------------------------------------------
+	//    Class:			thread_pool
+	//	  Method:			run(size_t n, F f)
+	//
+	//	  Description:		fork/join over the indices 0 .. n - 1. One helper
+	//						task per worker (at most n - 1) and the caller all
+	//						claim indices from a shared counter, so a slow index
+	//						does not hold up the rest. The caller waits for every
+	//						helper to leave before the shared state goes out of
+	//						scope; once an index throws, no new ones are started.
+	//
+	//    Calls:            submit()
+	//    Called By:		parallel algorithms
+	//
+	//    Parameters:		size_t n, F f -- f(size_t i) for each index
+	//
+	//    History Log:
+	//                      10/17/2026 RD completed version
+	//-----------------------------------------------------------------------------
+
+	template <class F>
+	void thread_pool::run(size_t n, F f)
+	{
+		struct batch
+		{
+			atomic<size_t> next;
+			atomic<bool> failed;
+			mutex lock; // guards helpers and error
+			condition_variable done;
+			size_t helpers;
+			exception_ptr error;
+		} b;
+		b.next = 0;
+		b.failed = false;
+		b.helpers = 0;
+
+		auto drain = [&b, &f, n]()
+		{
+			for (size_t i = b.next++; i < n && !b.failed; i = b.next++)
+			{
+				try { f(i); }
+				catch (...)
+				{
+					lock_guard<mutex> guard(b.lock);
+					if (!b.error)
+						b.error = current_exception();
+					b.failed = true;
+				}
+			}
+		};
+
+		size_t helpers = n > 1 ? n - 1 : 0;
+		if (helpers > m_threads.size())
+			helpers = m_threads.size();
+		b.helpers = helpers;
+		for (size_t h = 0; h < helpers; h++)
+			submit([&b, &drain]()
+			{
+				drain();
+				lock_guard<mutex> guard(b.lock);
+				if (--b.helpers == 0)
+					b.done.notify_one();
+			});
+
+		drain();
+		unique_lock<mutex> guard(b.lock);
+		b.done.wait(guard, [&b]() { return b.helpers == 0; });
+		if (b.error)
+			rethrow_exception(b.error);
+	}
+
+	//-----------------------------------------------------------------------------
+	//    Class:			thread_pool
+	//	  Method:			work()
+	//
+	//	  Description:		worker loop; sleeps until a task is queued, runs
+	//						it outside the lock, and exits once stopped and the
+	//						queue is empty
+	//
+	//    Calls:            CQueue::pop()
+	//    Called By:		worker threads
+	//
+	//    Parameters:		none
+	//
+	//    History Log:
+	//                      10/17/2026 RD completed version
+	//-----------------------------------------------------------------------------
+
+	inline void thread_pool::work()
+	{
+		for (;;)
+		{
+			function<void()> task;
+			{
+				unique_lock<mutex> guard(m_lock);
+				m_wake.wait(guard, [this]() { return m_stop || !m_tasks.empty(); });
+				if (m_tasks.empty())
+					return;
+				task = m_tasks.pop();
+			}
+			task();
+		}
+	}
+}
+
+#endif
@@ -0,0 +1,808 @@
+//-----------------------------------------------------------------------------
+//   File: UnrolledList.h
+//-----------------------------------------------------------------------------
+
+//-----------------------------------------------------------------------------
+//   Title: unrolled_list Class
+//   Description: This file contains the class definition for unrolled_list,
+//                the chunked storage variant of list
+//
+//   Programmer: Reinaldo Daniswara
+//
+//   Date: 10/17/2026
+//   Version: 1.0
+//
+//   Environment: Intel Core i7
+//     Software: MS Windows 10 for execution;
+//     Compiles under Microsoft Visual Studio 2015
+//
+//   class unrolled_list<T, Cap, Alloc>:
+//
+//     Doubly linked list of chunks; each chunk holds up to Cap
+//     elements in a contiguous array, so scans and copies walk arrays and
+//     only follow a pointer once per chunk. Same interface as list<T>.
+//
+//     Template Parameters:
+//       T -- element type
+//       Cap -- elements per chunk, sized to about 256 bytes by default
+//       Alloc -- allocator policy, rebound to chunk (see Pool.h)
+//
+//     Properties:
+//       chunk *head -- front chunk
+//       chunk *tail -- back chunk
+//       unsigned m_size -- number of elements in the list
+//       chunk_allocator m_alloc -- hands out chunks
+//
+//     Methods:
+//
+//       inline:
+//         unrolled_list() -- construct the empty list
+//         ~unrolled_list() { release(); } -- destructor
+//         unsigned getSize()const  -- accessor, returns m_size
+//         begin(), cbegin() -- position of first element
+//         end(), cend() -- one past the last element
+//         rbegin(), rend() -- reverse iterators
+//         T& front()const  -- returns first element data
+//         T& back()const -- returns last element data
+//         bool empty()const -- true if no elements
+//         void push_front(const T&), push_front(T&&) -- forward to emplace_front
+//         void push_back(const T&), push_back(T&&) -- forward to emplace_back
+//         void release() -- removes all items from list
+//
+//       non-inline:
+//         unrolled_list(size_t n_elements, const T& datum) -- n copies of datum
+//         unrolled_list(const unrolled_list& x) -- copy constructor, chunk by chunk
+//         unrolled_list(unrolled_list&& x) -- move constructor
+//         unrolled_list(InputIt b, InputIt e) -- copies [b, e) from any input iterators
+//         void emplace_front(Args&&... args) -- insert element at front
+//         T pop_front() -- removes front element and returns its data
+//         void emplace_back(Args&&... args) -- insert element at back
+//         T pop_back() -- removes back element and returns its data
+//         void swap(unrolled_list& x) -- exchanges contents in O(1)
+//         unrolled_list& operator=(const unrolled_list&), operator=(unrolled_list&&)
+//         T& operator[](int index), const T& operator[](int index)const
+//
+//       private:
+//         chunk* new_chunk(unsigned at) -- empty chunk whose free run starts at slot at
+//         void link_front(chunk* c), link_back(chunk* c) -- hook a chunk on at either end
+//         void unlink(chunk* c) -- unhook an emptied chunk and free it
+//
+//    Public Nested Structures:
+//
+//      struct chunk -- list cell
+//        chunk *next, *prev -- links
+//        unsigned first, last -- live elements are slots [first, last)
+//        T* slots() -- the element array
+//
+//     class basic_iterator<Const> -- bidirectional position (chunk, slot);
+//                       iterator and const_iterator, end() holds a null
+//                       chunk like list<T>::iterator, and ++ follows the
+//                       chunk's own next link, so positions survive swap
+//                       and moves
+//
+//   History Log:
+//			10/17/2026 RD completed version 1.0
+//			10/17/2026 RD standard bidirectional iterators with a past-the-end sentinel
+//			10/17/2026 RD operator<< renders through list_formatter (Format.h)
+//			10/17/2026 RD null-terminated chunk links, iterators survive swap and moves
+//-----------------------------------------------------------------------------
+
+#ifndef UNROLLED_LIST_H
+#define UNROLLED_LIST_H
+#include <iostream>
+#include <cassert>
+#include <cstdlib>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include "Pool.h"
+#include "Format.h"
+
+using namespace std;
+
+namespace RD_ADT
+{
+
+	template <class T, unsigned Cap = (sizeof(T) < 32 ? 256 / sizeof(T) : 8), class Alloc = pool_allocator<T> >
+	class unrolled_list
+	{
+	public:
+		struct chunk; // forward declarations
+		template <bool Const> class basic_iterator;
+		typedef basic_iterator<false> iterator;
+		typedef basic_iterator<true> const_iterator;
+		typedef std::reverse_iterator<iterator> reverse_iterator;
+		typedef std::reverse_iterator<const_iterator> const_reverse_iterator;
+		typedef T value_type;
+		typedef size_t size_type;
+		// constructors
+		unrolled_list() : head(nullptr), tail(nullptr), m_size(0) {}
+		unrolled_list(size_t n_elements, const T& datum);
+		unrolled_list(const unrolled_list& x);
+		unrolled_list(unrolled_list&& x);
+		template <class InputIt, class = typename iterator_traits<InputIt>::iterator_category>
+		unrolled_list(InputIt b, InputIt e);
+
+		~unrolled_list() { release(); }
+		unsigned getSize() const { return m_size; }
+		size_t size() const { return m_size; }
+		iterator begin() { return iterator(head, head == nullptr ? 0 : head->first, this); }
+		const_iterator begin() const { return const_iterator(head, head == nullptr ? 0 : head->first, this); }
+		iterator end() { return iterator(nullptr, 0, this); }
+		const_iterator end() const { return const_iterator(nullptr, 0, this); }
+		const_iterator cbegin() const { return begin(); }
+		const_iterator cend() const { return end(); }
+		reverse_iterator rbegin() { return reverse_iterator(end()); }
+		const_reverse_iterator rbegin() const { return const_reverse_iterator(end()); }
+		reverse_iterator rend() { return reverse_iterator(begin()); }
+		const_reverse_iterator rend() const { return const_reverse_iterator(begin()); }
+		void push_front(const T& datum) { emplace_front(datum); }
+		void push_front(T&& datum) { emplace_front(std::move(datum)); }
+		template <class... Args>
+		void emplace_front(Args&&... args);
+		T pop_front();
+		void push_back(const T& datum) { emplace_back(datum); }
+		void push_back(T&& datum) { emplace_back(std::move(datum)); }
+		template <class... Args>
+		void emplace_back(Args&&... args);
+		T pop_back();
+		T& front() const { return head->slots()[head->first]; }
+		T& back() const { return tail->slots()[tail->last - 1]; }
+		bool empty() const { return head == nullptr; }
+		void release() { while (head != nullptr) pop_front(); }
+		void swap(unrolled_list& x);
+		unrolled_list& operator=(const unrolled_list& rlist);
+		unrolled_list& operator=(unrolled_list&& rlist);
+		T& operator[](int index);
+		const T& operator[](int index) const { return const_cast<unrolled_list*>(this)->operator[](index); }
+
+	private:
+		typedef typename allocator_traits<Alloc>::template rebind_alloc<chunk> chunk_allocator;
+		typedef allocator_traits<chunk_allocator> chunk_traits;
+
+		chunk* new_chunk(unsigned at);
+		void link_front(chunk* c);
+		void link_back(chunk* c);
+		void unlink(chunk* c);
+
+		chunk *head;
+		chunk *tail;
+		unsigned m_size; // number of elements in the list
+		chunk_allocator m_alloc; // hands out chunks
+	public:
+		struct chunk // list cell
+		{
+			chunk *next;
+			chunk *prev;
+			unsigned first; // first live slot
+			unsigned last;  // one past the last live slot
+			alignas(T) unsigned char raw[Cap * sizeof(T)];
+			T* slots() { return reinterpret_cast<T*>(raw); }
+		};
+		// scoped within class unrolled_list !
+		template <bool Const>
+		class basic_iterator
+		{
+		public:
+			typedef bidirectional_iterator_tag iterator_category;
+			typedef T value_type;
+			typedef ptrdiff_t difference_type;
+			typedef typename conditional<Const, const T*, T*>::type pointer;
+			typedef typename conditional<Const, const T&, T&>::type reference;
+
+			basic_iterator() : ptr(nullptr), slot(0), owner(nullptr) {}
+			basic_iterator(chunk* c, unsigned i, const unrolled_list* o) : ptr(c), slot(i), owner(o) {}
+			operator basic_iterator<true>() const { return basic_iterator<true>(ptr, slot, owner); }
+			basic_iterator& operator++();
+			basic_iterator& operator--();
+			basic_iterator operator++(int) { basic_iterator temp = *this; ++*this; return temp; }
+			basic_iterator operator--(int) { basic_iterator temp = *this; --*this; return temp; }
+			pointer operator->() const { return &ptr->slots()[slot]; }
+			reference operator*() const { return ptr->slots()[slot]; }
+			friend bool operator==(const basic_iterator& a, const basic_iterator& b) { return a.ptr == b.ptr && a.slot == b.slot; }
+			friend bool operator!=(const basic_iterator& a, const basic_iterator& b) { return !(a == b); }
+		private:
+			chunk* ptr; // current chunk, nullptr at end()
+			unsigned slot; // element within ptr
+			const unrolled_list* owner; // list walked, to step off the tail and back from end()
+		};
+	};
+
+	template <class T, unsigned Cap, class Alloc>
+	ostream& operator<<(ostream& sout, const unrolled_list<T, Cap, Alloc>& x);
+
+	//-----------------------------------------------------------------------------
+	//    Class:			unrolled_list<T>
+	//	  Method:			unrolled_list(size_t n_elements, const T& datum)
+	//
+	//	  Description:		Constructor for unrolled_list<T>
+	//
+	//    Calls:            push_back()
+	//    Called By:		main
+	//
+	//    Parameters:		size_t n_elements, const T& datum
+	//
+	//    History Log:
+	//                      10/17/2026 RD completed version
+	//-----------------------------------------------------------------------------
+
+	template <class T, unsigned Cap, class Alloc>
+	unrolled_list<T, Cap, Alloc>::unrolled_list(size_t n_elements, const T& datum)
+		: head(nullptr), tail(nullptr), m_size(0)
+	{
+		if (n_elements <= 0)
+			throw out_of_range("Empty list");
+		for (size_t i = 0; i < n_elements; ++i)
+			push_back(datum);
+	}
+
+	//-----------------------------------------------------------------------------
+	//    Class:			unrolled_list<T>
+	//	  Method:			unrolled_list(const unrolled_list<T>& x)
+	//
+	//	  Description:		Copy constructor, copies each source run into
+	//						packed chunks with uninitialized_copy
+	//
+	//    Calls:            new_chunk(), link_back()
+	//    Called By:		main
+	//
+	//    Parameters:		const unrolled_list<T>& x
+	//
+	//    History Log:
+	//                      10/17/2026 RD completed version
+	//-----------------------------------------------------------------------------
+
+	template <class T, unsigned Cap, class Alloc>
+	unrolled_list<T, Cap, Alloc>::unrolled_list(const unrolled_list<T, Cap, Alloc>& x)
+		: head(nullptr), tail(nullptr), m_size(0),
+		m_alloc(chunk_traits::select_on_container_copy_construction(x.m_alloc))
+	{
+		if (x.empty())
+			return;
+		try
+		{
+			for (chunk* src = x.head; src != nullptr; src = src->next)
+			{
+				unsigned i = src->first;
+				while (i < src->last)
+				{
+					if (tail == nullptr || tail->last == Cap)
+						link_back(new_chunk(0));
+					unsigned n = min(src->last - i, Cap - tail->last);
+					uninitialized_copy(src->slots() + i, src->slots() + i + n, tail->slots() + tail->last);
+					tail->last += n;
+					m_size += n;
+					i += n;
+				}
+			}
+		}
+		catch (...)
+		{
+			if (tail != nullptr && tail->first == tail->last)
+				unlink(tail);
+			release();
+			throw;
+		}
+	}
+
+	//-----------------------------------------------------------------------------
+	//    Class:			unrolled_list<T>
+	//	  Method:			unrolled_list(unrolled_list<T>&& x)
+	//
+	//	  Description:		Move constructor, takes over the chunks of x
+	//
+	//    Calls:            push_back(), pop_front()
+	//    Called By:		main
+	//
+	//    Parameters:		unrolled_list<T>&& x
+	//
+	//    History Log:
+	//                      10/17/2026 RD completed version
+	//-----------------------------------------------------------------------------
+
+	template <class T, unsigned Cap, class Alloc>
+	unrolled_list<T, Cap, Alloc>::unrolled_list(unrolled_list<T, Cap, Alloc>&& x)
+		: head(nullptr), tail(nullptr), m_size(0), m_alloc(std::move(x.m_alloc))
+	{
+		if (m_alloc == x.m_alloc)
+		{
+			head = x.head;
+			tail = x.tail;
+			m_size = x.m_size;
+			x.head = x.tail = nullptr;
+			x.m_size = 0;
+		}
+		else
+		{
+			while (!x.empty())
+				push_back(x.pop_front());
+		}
+	}
+
+	//-----------------------------------------------------------------------------
+	//    Class:			unrolled_list<T>
+	//	  Method:			unrolled_list(InputIt b, InputIt e)
+	//
+	//	  Description:		constructor using iterators, copies from b to one before e
+	//
+	//    Calls:            push_back()
+	//    Called By:		main
+	//
+	//    Parameters:		InputIt b, InputIt e -- any input iterators
+	//
+	//    History Log:
+	//                      10/17/2026 RD completed version
+	//                      10/17/2026 RD takes any input iterators, e is past the end
+	//-----------------------------------------------------------------------------
+
+	template <class T, unsigned Cap, class Alloc>
+	template <class InputIt, class>
+	unrolled_list<T, Cap, Alloc>::unrolled_list(InputIt b, InputIt e)
+		: head(nullptr), tail(nullptr), m_size(0)
+	{
+		for (; b != e; ++b)
+			push_back(*b);
+	}
+
+	//-----------------------------------------------------------------------------
+	//    Class:			unrolled_list<T>
+	//	  Function:			ostream& operator<<(ostream& sout, const unrolled_list<T>& x)
+	//	  Description:		displays elements to sout
+	//
+	//	  Input:			None
+	//
+	//	  Output:			elements to sout
+	//
+	//    Calls:            print_list()
+	//    Called By:		main
+	//
+	//    Parameters:		ostream& sout, const unrolled_list<T>& x
+	//	  Returns:          ostream & sout
+	//
+	//    History Log:
+	//                      10/17/2026 RD completed version
+	//                      10/17/2026 RD stops at the sentinel end
+	//                      10/17/2026 RD formats into one buffer, one write
+	//-----------------------------------------------------------------------------
+
+	template <class T, unsigned Cap, class Alloc>
+	ostream& operator<<(ostream& sout, const unrolled_list<T, Cap, Alloc>& x)
+	{
+		return print_list(sout, x);
+	}
+
+	//-----------------------------------------------------------------------------
+	//    Class:			unrolled_list<T>
+	//	  Method:			new_chunk(unsigned at)
+	//
+	//	  Description:		allocates an empty chunk whose free run starts at
+	//						slot at: 0 for growth at the back, Cap for the front
+	//
+	//    Calls:            none
+	//    Called By:		emplace_front(), emplace_back(), copy constructor
+	//
+	//    Parameters:		unsigned at
+	//	  Return:			the chunk, not yet linked
+	//
+	//    History Log:
+	//                      10/17/2026 RD completed version
+	//-----------------------------------------------------------------------------
+
+	template <class T, unsigned Cap, class Alloc>
+	typename unrolled_list<T, Cap, Alloc>::chunk* unrolled_list<T, Cap, Alloc>::new_chunk(unsigned at)
+	{
+		chunk* c = chunk_traits::allocate(m_alloc, 1);
+		c->next = c->prev = nullptr;
+		c->first = c->last = at;
+		return c;
+	}
+
+	//-----------------------------------------------------------------------------
+	//    Class:			unrolled_list<T>
+	//	  Method:			link_front(chunk* c), link_back(chunk* c)
+	//
+	//	  Description:		hooks c on as the new head or tail
+	//
+	//    Calls:            none
+	//    Called By:		emplace_front(), emplace_back(), copy constructor
+	//
+	//    Parameters:		chunk* c
+	//
+	//    History Log:
+	//                      10/17/2026 RD completed version
+	//-----------------------------------------------------------------------------
+
+	template <class T, unsigned Cap, class Alloc>
+	void unrolled_list<T, Cap, Alloc>::link_front(chunk* c)
+	{
+		c->next = head;
+		if (head == nullptr)
+			tail = c;
+		else
+			head->prev = c;
+		head = c;
+	}
+
+	template <class T, unsigned Cap, class Alloc>
+	void unrolled_list<T, Cap, Alloc>::link_back(chunk* c)
+	{
+		c->prev = tail;
+		if (tail == nullptr)
+			head = c;
+		else
+			tail->next = c;
+		tail = c;
+	}
+
+	//-----------------------------------------------------------------------------
+	//    Class:			unrolled_list<T>
+	//	  Method:			unlink(chunk* c)
+	//
+	//	  Description:		unhooks an emptied head or tail chunk and frees it
+	//
+	//    Calls:            none
+	//    Called By:		pop_front(), pop_back()
+	//
+	//    Parameters:		chunk* c
+	//
+	//    History Log:
+	//                      10/17/2026 RD completed version
+	//-----------------------------------------------------------------------------
+
+	template <class T, unsigned Cap, class Alloc>
+	void unrolled_list<T, Cap, Alloc>::unlink(chunk* c)
+	{
+		if (c->prev != nullptr)
+			c->prev->next = c->next;
+		else
+			head = c->next;
+		if (c->next != nullptr)
+			c->next->prev = c->prev;
+		else
+			tail = c->prev;
+		chunk_traits::deallocate(m_alloc, c, 1);
+	}
+
+	//-----------------------------------------------------------------------------
+	//    Class:			unrolled_list<T>
+	//	  Method:			emplace_front(Args&&... args)
+	//
+	//	  Description:		insert element at front of list, into the free
+	//						slots before head->first or a new chunk
+	//
+	//    Calls:            new_chunk(), link_front()
+	//    Called By:		push_front()
+	//
+	//    Parameters:		Args&&... args
+	//
+	//    History Log:
+	//                      10/17/2026 RD completed version
+	//-----------------------------------------------------------------------------
+
+	template <class T, unsigned Cap, class Alloc>
+	template <class... Args>
+	void unrolled_list<T, Cap, Alloc>::emplace_front(Args&&... args)
+	{
+		if (head == nullptr || head->first == 0)
+			link_front(new_chunk(Cap));
+		try { ::new (static_cast<void*>(head->slots() + head->first - 1)) T(std::forward<Args>(args)...); }
+		catch (...)
+		{
+			if (head->first == head->last)
+				unlink(head);
+			throw;
+		}
+		head->first--;
+		m_size++;
+	}
+
+	//-----------------------------------------------------------------------------
+	//    Class:			unrolled_list<T>
+	//	  Method:			emplace_back(Args&&... args)
+	//
+	//	  Description:		insert element at back of list, into the free
+	//						slots after tail->last or a new chunk
+	//
+	//    Calls:            new_chunk(), link_back()
+	//    Called By:		push_back()
+	//
+	//    Parameters:		Args&&... args
+	//
+	//    History Log:
+	//                      10/17/2026 RD completed version
+	//-----------------------------------------------------------------------------
+
+	template <class T, unsigned Cap, class Alloc>
+	template <class... Args>
+	void unrolled_list<T, Cap, Alloc>::emplace_back(Args&&... args)
+	{
+		if (tail == nullptr || tail->last == Cap)
+			link_back(new_chunk(0));
+		try { ::new (static_cast<void*>(tail->slots() + tail->last)) T(std::forward<Args>(args)...); }
+		catch (...)
+		{
+			if (tail->first == tail->last)
+				unlink(tail);
+			throw;
+		}
+		tail->last++;
+		m_size++;
+	}
+
+	//-----------------------------------------------------------------------------
+	//    Class:			unrolled_list<T>
+	//	  Method:			pop_front()
+	//
+	//	  Description:		removes front element and returns the data from
+	//						that element; frees the head chunk once it empties
+	//	  Return:			data, moved out of the slot
+	//
+	//    Calls:            unlink()
+	//    Called By:		release()
+	//
+	//    Parameters:		none
+	//
+	//    History Log:
+	//                      10/17/2026 RD completed version
+	//-----------------------------------------------------------------------------
+
+	template <class T, unsigned Cap, class Alloc>
+	T unrolled_list<T, Cap, Alloc>::pop_front()
+	{
+		if (head == nullptr)
+			throw runtime_error("Empty list");
+
+		T* p = head->slots() + head->first;
+		T data(std::move(*p));
+		p->~T();
+		if (++head->first == head->last)
+			unlink(head);
+		m_size--;
+		return data;
+	}
+
+	//-----------------------------------------------------------------------------
+	//    Class:			unrolled_list<T>
+	//	  Method:			pop_back()
+	//
+	//	  Description:		removes back element and returns the data from
+	//						that element; frees the tail chunk once it empties
+	//	  Return:			data, moved out of the slot
+	//
+	//    Calls:            unlink()
+	//    Called By:		n/a
+	//
+	//    Parameters:		none
+	//
+	//    History Log:
+	//                      10/17/2026 RD completed version
+	//-----------------------------------------------------------------------------
+
+	template <class T, unsigned Cap, class Alloc>
+	T unrolled_list<T, Cap, Alloc>::pop_back()
+	{
+		if (tail == nullptr)
+			throw runtime_error("Empty list");
+
+		T* p = tail->slots() + tail->last - 1;
+		T data(std::move(*p));
+		p->~T();
+		if (--tail->last == tail->first)
+			unlink(tail);
+		m_size--;
+		return data;
+	}
+
+	//-----------------------------------------------------------------------------
+	//    Class:			unrolled_list<T>
+	//	  Method:			swap(unrolled_list & x)
+	//
+	//	  Description:		exchanges the contents of two lists in O(1); the
+	//						allocators must compare equal
+	//
+	//    Calls:            none
+	//    Called By:		operator=(unrolled_list&&)
+	//
+	//    Parameters:		unrolled_list & x
+	//
+	//    History Log:
+	//                      10/17/2026 RD completed version
+	//-----------------------------------------------------------------------------
+
+	template <class T, unsigned Cap, class Alloc>
+	void unrolled_list<T, Cap, Alloc>::swap(unrolled_list<T, Cap, Alloc>& x)
+	{
+		assert(m_alloc == x.m_alloc);
+		std::swap(head, x.head);
+		std::swap(tail, x.tail);
+		std::swap(m_size, x.m_size);
+	}
+
+	//-----------------------------------------------------------------------------
+	//    Class:			unrolled_list<T>
+	//	  Method:			operator=(const unrolled_list & rlist)
+	//
+	//	  Description:		replaces the contents with a copy of rlist
+	//
+	//    Calls:            copy constructor, swap()
+	//    Called By:		n/a
+	//
+	//    Parameters:		const unrolled_list & rlist
+	//	  Return:			*this
+	//
+	//    History Log:
+	//                      10/17/2026 RD completed version
+	//-----------------------------------------------------------------------------
+
+	template <class T, unsigned Cap, class Alloc>
+	unrolled_list<T, Cap, Alloc>& unrolled_list<T, Cap, Alloc>::operator=(const unrolled_list<T, Cap, Alloc>& rlist)
+	{
+		if (&rlist != this)
+		{
+			unrolled_list<T, Cap, Alloc> temp(rlist);
+			release();
+			if (m_alloc == temp.m_alloc)
+				swap(temp);
+			else
+			{
+				while (!temp.empty())
+					push_back(temp.pop_front());
+			}
+		}
+		return *this;
+	}
+
+	//-----------------------------------------------------------------------------
+	//    Class:			unrolled_list<T>
+	//	  Method:			operator=(unrolled_list && rlist)
+	//
+	//	  Description:		takes over the chunks of rlist, leaving it empty
+	//
+	//    Calls:            release(), swap(), push_back(), pop_front()
+	//    Called By:		n/a
+	//
+	//    Parameters:		unrolled_list && rlist
+	//	  Return:			*this
+	//
+	//    History Log:
+	//                      10/17/2026 RD completed version
+	//-----------------------------------------------------------------------------
+
+	template <class T, unsigned Cap, class Alloc>
+	unrolled_list<T, Cap, Alloc>& unrolled_list<T, Cap, Alloc>::operator=(unrolled_list<T, Cap, Alloc>&& rlist)
+	{
+		if (&rlist != this)
+		{
+			release();
+			if (m_alloc == rlist.m_alloc)
+				swap(rlist);
+			else
+			{
+				while (!rlist.empty())
+					push_back(rlist.pop_front());
+			}
+		}
+		return *this;
+	}
+
+	//-----------------------------------------------------------------------------
+	//    Class:			unrolled_list<T>
+	//	  Method:			operator[](int index)
+	//
+	//	  Description:		[] operator, negative index counts from the back;
+	//						skips whole chunks from the nearer end
+	//
+	//    Calls:            getSize()
+	//    Called By:		main
+	//
+	//    Parameters:		int index
+	//	  Return:			data at index
+	//
+	//    History Log:
+	//                      10/17/2026 RD completed version
+	//-----------------------------------------------------------------------------
+
+	template <class T, unsigned Cap, class Alloc>
+	T& unrolled_list<T, Cap, Alloc>::operator[](int index)
+	{
+		int size = static_cast<int>(getSize());
+		if (index >= size || index < -size)
+			throw out_of_range("index out-of-range");
+		unsigned pos = index >= 0 ? index : size + index; // make the range positive
+
+		if (pos < m_size / 2)
+		{
+			chunk* c = head;
+			while (pos >= c->last - c->first)
+			{
+				pos -= c->last - c->first;
+				c = c->next;
+			}
+			return c->slots()[c->first + pos];
+		}
+
+		unsigned back = m_size - 1 - pos; // distance from the last element
+		chunk* c = tail;
+		while (back >= c->last - c->first)
+		{
+			back -= c->last - c->first;
+			c = c->prev;
+		}
+		return c->slots()[c->last - 1 - back];
+	}
+
+	//-----------------------------------------------------------------------------
+	//    Class:			unrolled_list<T>
+	//	  Method:			basic_iterator<Const>::operator++()
+	//
+	//	  Description:		pre-increment, steps into the next chunk at the
+	//						end of a run and from the tail to end()
+	//	  Return:			*this
+	//
+	//    Calls:            none
+	//    Called By:		operator++(int)
+	//
+	//    Parameters:		None
+	//
+	//    History Log:
+	//                      10/17/2026 RD completed version
+	//                      10/17/2026 RD stops at end() instead of wrapping to the head
+	//                      10/17/2026 RD follows the chunk's link, not the owner's tail
+	//-----------------------------------------------------------------------------
+
+	template <class T, unsigned Cap, class Alloc>
+	template <bool Const>
+	typename unrolled_list<T, Cap, Alloc>::template basic_iterator<Const>& unrolled_list<T, Cap, Alloc>::basic_iterator<Const>::operator++()
+	{
+		if (ptr == nullptr)
+			throw runtime_error("nullptr pointer");
+		if (++slot == ptr->last)
+		{
+			ptr = ptr->next;
+			slot = ptr == nullptr ? 0 : ptr->first;
+		}
+		return *this;
+	}
+
+	//-----------------------------------------------------------------------------
+	//    Class:			unrolled_list<T>
+	//	  Method:			basic_iterator<Const>::operator--()
+	//
+	//	  Description:		pre-decrement, steps into the previous chunk at the
+	//						start of a run and from end() to the tail
+	//	  Return:			*this
+	//
+	//    Calls:            none
+	//    Called By:		operator--(int), reverse_iterator
+	//
+	//    Parameters:		None
+	//
+	//    History Log:
+	//                      10/17/2026 RD completed version
+	//                      10/17/2026 RD end() steps back to the tail
+	//-----------------------------------------------------------------------------
+
+	template <class T, unsigned Cap, class Alloc>
+	template <bool Const>
+	typename unrolled_list<T, Cap, Alloc>::template basic_iterator<Const>& unrolled_list<T, Cap, Alloc>::basic_iterator<Const>::operator--()
+	{
+		if (ptr == nullptr)
+		{
+			if (owner == nullptr || owner->tail == nullptr)
+				throw runtime_error("nullptr pointer");
+			ptr = owner->tail;
+			slot = ptr->last;
+		}
+		else if (slot == ptr->first)
+		{
+			ptr = ptr->prev;
+			slot = ptr->last;
+		}
+		slot--;
+		return *this;
+	}
+}
+
+#endif
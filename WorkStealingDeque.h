@@ -0,0 +1,249 @@
+//-----------------------------------------------------------------------------
+//   File: WorkStealingDeque.h
+//-----------------------------------------------------------------------------
+
+//-------------------------------------------------------------------------------------------
+//    Class:			CWorkStealingDeque
+//
+//    File:             WorkStealingDeque.h
+//
+//    Title:            CWorkStealingDeque Class
+//
+//    Description:		This file contains the class definition for
+//						CWorkStealingDeque, a Chase-Lev work stealing deque:
+//						one owner thread pushes and pops at the bottom like
+//						list's push_front/pop_front, any thread steals from
+//						the top like pop_back
+//
+//    Programmer:		Reinaldo Daniswara
+//
+//    Date:             10/17/2026
+//
+//    Version:          1.0
+//
+//   Environment:		Intel COre i7
+//						Software: MS Windows 10 for execution;
+//						Compiles under Microsoft Visual Studio 2015
+//
+//	  class CWorkStealingDeque<T>:
+//
+//	  The elements sit in a circular array between top and bottom, two
+//	  ever growing indices. The owner works at bottom without a lock;
+//	  thieves claim top with a compare-and-swap, and the owner only races
+//	  them for the last element. When the array fills the owner copies it
+//	  into one twice the size; a thief may still be reading the old one, so
+//	  old arrays are kept until the deque is destroyed, which costs at most
+//	  the size of the final array again. T is copied in and out of atomic
+//	  slots, so it must be trivially copyable; queue pointers to anything
+//	  bigger.
+//
+//	  Methods:
+//
+//		inline:
+//		CWorkStealingDeque(size_t capacity = 64) -- rounded up to a power of two
+//		~CWorkStealingDeque() -- frees every array, no thread may be stealing
+//		unsigned getSize() const -- number of elements, a snapshot
+//		bool empty() const -- true if the snapshot holds no elements
+//
+//		non-inline:
+//		void push(T x) -- owner only, adds x at the bottom
+//		bool pop(T& out) -- owner only, takes the newest element
+//		bool steal(T& out) -- any thread, takes the oldest element; false if
+//							  empty or another thread won the race for it
+//		array* grow(array* a, long long b, long long t) -- owner only,
+//							  private, copies the live range into a bigger array
+//
+//    History Log:
+//                           10/17/2026  RD  completed version 1.0
+// ----------------------------------------------------------------------------
+
+#ifndef WORK_STEALING_DEQUE_H
+#define WORK_STEALING_DEQUE_H
+#include <atomic>
+#include <memory>
+#include <type_traits>
+#include <vector>
+
+using namespace std;
+
+namespace RD_ADT
+{
+	template <class T>
+	class CWorkStealingDeque
+	{
+		static_assert(is_trivially_copyable<T>::value, "CWorkStealingDeque holds trivially copyable elements");
+	public:
+		explicit CWorkStealingDeque(size_t capacity = 64) : m_top(0), m_bottom(0)
+		{
+			size_t size = 2;
+			while (size < capacity)
+				size *= 2;
+			m_arrays.emplace_back(new array(size));
+			m_array.store(m_arrays.back().get(), memory_order_relaxed);
+		}
+		CWorkStealingDeque(const CWorkStealingDeque&) = delete;
+		CWorkStealingDeque& operator=(const CWorkStealingDeque&) = delete;
+
+		unsigned getSize() const
+		{
+			long long b = m_bottom.load(memory_order_relaxed);
+			long long t = m_top.load(memory_order_relaxed);
+			return b > t ? static_cast<unsigned>(b - t) : 0;
+		}
+		bool empty() const { return getSize() == 0; }
+
+		void push(T x);
+		bool pop(T& out);
+		bool steal(T& out);
+
+	private:
+		struct array
+		{
+			explicit array(size_t size) : mask(size - 1), slots(new atomic<T>[size]) {}
+			size_t size() const { return mask + 1; }
+			T get(long long i) const { return slots[static_cast<size_t>(i) & mask].load(memory_order_relaxed); }
+			void put(long long i, T x) { slots[static_cast<size_t>(i) & mask].store(x, memory_order_relaxed); }
+
+			size_t mask;
+			unique_ptr<atomic<T>[]> slots;
+		};
+
+		array* grow(array* a, long long b, long long t);
+
+		alignas(64) atomic<long long> m_top; // next element to steal
+		alignas(64) atomic<long long> m_bottom; // next free slot, owner's end
+		atomic<array*> m_array; // current array
+		vector<unique_ptr<array> > m_arrays; // current one last, owner only
+	};
+
+	//-----------------------------------------------------------------------------
+	//    Class:			CWorkStealingDeque
+	//	  Method:			grow(array* a, long long b, long long t)
+	//
+	//	  Description:		copies elements t .. b - 1 into an array twice as
+	//						big and publishes it; the old one stays readable
+	//	  Return:			the new array
+	//
+	//    Calls:            none
+	//    Called By:		push()
+	//
+	//    Parameters:		array* a, long long b, long long t
+	//
+	//    History Log:
+	//                      10/17/2026 RD completed version
+	//-----------------------------------------------------------------------------
+
+	template <class T>
+	typename CWorkStealingDeque<T>::array* CWorkStealingDeque<T>::grow(array* a, long long b, long long t)
+	{
+		m_arrays.emplace_back(new array(a->size() * 2));
+		array* bigger = m_arrays.back().get();
+		for (long long i = t; i < b; i++)
+			bigger->put(i, a->get(i));
+		m_array.store(bigger, memory_order_release);
+		return bigger;
+	}
+
+	//-----------------------------------------------------------------------------
+	//    Class:			CWorkStealingDeque
+	//	  Method:			push(T x)
+	//
+	//	  Description:		owner only; stores x at bottom, then publishes it
+	//						by advancing bottom
+	//
+	//    Calls:            grow()
+	//    Called By:		fork_join_pool
+	//
+	//    Parameters:		T x
+	//
+	//    History Log:
+	//                      10/17/2026 RD completed version
+	//-----------------------------------------------------------------------------
+
+	template <class T>
+	void CWorkStealingDeque<T>::push(T x)
+	{
+		long long b = m_bottom.load(memory_order_relaxed);
+		long long t = m_top.load(memory_order_acquire);
+		array* a = m_array.load(memory_order_relaxed);
+		if (b - t > static_cast<long long>(a->size()) - 1)
+			a = grow(a, b, t);
+		a->put(b, x);
+		m_bottom.store(b + 1, memory_order_release);
+	}
+
+	//-----------------------------------------------------------------------------
+	//    Class:			CWorkStealingDeque
+	//	  Method:			pop(T& out)
+	//
+	//	  Description:		owner only; claims the bottom element by lowering
+	//						bottom first. Only when a single element is left
+	//						can a thief want it too, and then top decides
+	//	  Return:			false if the deque was empty or a thief took the
+	//						last element
+	//
+	//    Calls:            none
+	//    Called By:		fork_join_pool
+	//
+	//    Parameters:		T& out
+	//
+	//    History Log:
+	//                      10/17/2026 RD completed version
+	//-----------------------------------------------------------------------------
+
+	template <class T>
+	bool CWorkStealingDeque<T>::pop(T& out)
+	{
+		long long b = m_bottom.load(memory_order_relaxed) - 1;
+		array* a = m_array.load(memory_order_relaxed);
+		m_bottom.store(b, memory_order_seq_cst);
+		long long t = m_top.load(memory_order_seq_cst);
+		if (t > b)
+		{
+			m_bottom.store(b + 1, memory_order_relaxed);
+			return false;
+		}
+		out = a->get(b);
+		if (t < b)
+			return true;
+		// last element: race the thieves for it
+		bool won = m_top.compare_exchange_strong(t, t + 1, memory_order_seq_cst, memory_order_relaxed);
+		m_bottom.store(b + 1, memory_order_relaxed);
+		return won;
+	}
+
+	//-----------------------------------------------------------------------------
+	//    Class:			CWorkStealingDeque
+	//	  Method:			steal(T& out)
+	//
+	//	  Description:		reads the top element, then claims it by moving
+	//						top on with a compare-and-swap
+	//	  Return:			false if the deque was empty or the element went
+	//						to another thread; callers just try elsewhere
+	//
+	//    Calls:            none
+	//    Called By:		fork_join_pool
+	//
+	//    Parameters:		T& out
+	//
+	//    History Log:
+	//                      10/17/2026 RD completed version
+	//-----------------------------------------------------------------------------
+
+	template <class T>
+	bool CWorkStealingDeque<T>::steal(T& out)
+	{
+		long long t = m_top.load(memory_order_seq_cst);
+		long long b = m_bottom.load(memory_order_seq_cst);
+		if (t >= b)
+			return false;
+		array* a = m_array.load(memory_order_acquire);
+		T x = a->get(t);
+		if (!m_top.compare_exchange_strong(t, t + 1, memory_order_seq_cst, memory_order_relaxed))
+			return false;
+		out = x;
+		return true;
+	}
+}
+
+#endif
@@ -0,0 +1,158 @@
+//-----------------------------------------------------------------------------
+//   File: async_bench.cpp
+//
+//	 Function: main
+//-----------------------------------------------------------------------------
+#include "../AsyncQueue.h"
+#include "../BlockingQueue.h"
+#include <atomic>
+#include <chrono>
+#include <string>
+#include <thread>
+#include <vector>
+//-------------------------------------------------------------------------------------------
+//    Function:			main()
+//
+//    File:             async_bench.cpp
+//
+//    Title:            Coroutine Queue Benchmark
+//
+//    Description:		Hands items from one producer to many consumers
+//						and times each handoff: consumer coroutines awaiting
+//						CAsyncQueue on a manual_executor and on a
+//						pool_executor, against consumer threads blocked in
+//						CBlockingQueue::pop_wait. Needs C++20.
+//
+//    Programmer:		Reinaldo Daniswara
+//
+//    Date:             10/17/2026
+//
+//    Version:          1.0
+//
+//    Environment:   Intel COre i7
+//						Software: MS Windows 10 for execution;
+//						Compiles under Microsoft Visual Studio 2015
+//
+//    Input:			argv[1] -- items, 1000000 by default
+//
+//    Output:			CSV on cout: consumers_on,consumers,ns_per_item
+//
+//    Calls:            CAsyncQueue, manual_executor, pool_executor,
+//						CBlockingQueue
+//
+//    Called By:		n/a
+//
+//    Parameters:		int argc, char* argv[]
+//
+//    Returns:          EXIT_SUCCESS  = successful
+//					    EXIT_FAILURE = an item was lost
+//
+//    History Log:
+//                          10/17/2026  RD  completed version 1.0
+// ----------------------------------------------------------------------------
+
+using namespace RD_ADT;
+
+atomic<long long> consumed(0);
+
+// pops until it sees -1
+async_task consumer(CAsyncQueue<int>& q)
+{
+	for (;;)
+	{
+		int x = co_await q.pop();
+		if (x < 0)
+			break;
+		consumed.fetch_add(1, memory_order_relaxed);
+	}
+}
+
+double ns_since(chrono::steady_clock::time_point start, size_t items)
+{
+	return chrono::duration<double, nano>(chrono::steady_clock::now() - start).count() / items;
+}
+
+double manual(size_t consumers, size_t items)
+{
+	manual_executor exec;
+	CAsyncQueue<int> q(exec);
+	for (size_t c = 0; c < consumers; c++)
+		spawn(exec, consumer(q));
+	exec.run(); // every consumer now waits
+	chrono::steady_clock::time_point start = chrono::steady_clock::now();
+	for (size_t i = 0; i < items; i++)
+	{
+		q.push(1);
+		if (i % 64 == 63)
+			exec.run();
+	}
+	for (size_t c = 0; c < consumers; c++)
+		q.push(-1);
+	exec.run();
+	return ns_since(start, items);
+}
+
+double pooled(size_t consumers, size_t items)
+{
+	thread_pool pool(thread_pool::default_workers() > 0 ? thread_pool::default_workers() : 1);
+	pool_executor exec(pool);
+	CAsyncQueue<int> q(exec);
+	for (size_t c = 0; c < consumers; c++)
+		spawn(exec, consumer(q));
+	chrono::steady_clock::time_point start = chrono::steady_clock::now();
+	for (size_t i = 0; i < items; i++)
+		q.push(1);
+	for (size_t c = 0; c < consumers; c++)
+		q.push(-1);
+	while (consumed.load() < static_cast<long long>(items) || q.getSize() > 0)
+		this_thread::yield();
+	return ns_since(start, items);
+}
+
+double threads(size_t consumers, size_t items)
+{
+	CBlockingQueue<int> q;
+	vector<thread> workers;
+	for (size_t c = 0; c < consumers; c++)
+		workers.emplace_back([&q]()
+		{
+			int x;
+			while (q.pop_wait(x))
+				consumed.fetch_add(1, memory_order_relaxed);
+		});
+	chrono::steady_clock::time_point start = chrono::steady_clock::now();
+	for (size_t i = 0; i < items; i++)
+		q.push(1);
+	q.close();
+	for (thread& t : workers)
+		t.join();
+	return ns_since(start, items);
+}
+
+int main(int argc, char* argv[])
+{
+	size_t items = argc > 1 ? stoul(argv[1]) : 1000000;
+
+	cout << "consumers_on,consumers,ns_per_item\n";
+	size_t coroutine_counts[] = { 10, 1000, 100000 };
+	for (size_t consumers : coroutine_counts)
+	{
+		consumed = 0;
+		cout << "manual_executor," << consumers << ',' << manual(consumers, items) << '\n';
+		if (consumed != static_cast<long long>(items))
+			return EXIT_FAILURE;
+		consumed = 0;
+		cout << "pool_executor," << consumers << ',' << pooled(consumers, items) << '\n';
+		if (consumed != static_cast<long long>(items))
+			return EXIT_FAILURE;
+	}
+	size_t thread_counts[] = { 10, 100 };
+	for (size_t consumers : thread_counts)
+	{
+		consumed = 0;
+		cout << "blocked_threads," << consumers << ',' << threads(consumers, items) << '\n';
+		if (consumed != static_cast<long long>(items))
+			return EXIT_FAILURE;
+	}
+	return EXIT_SUCCESS;
+}
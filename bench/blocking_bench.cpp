@@ -0,0 +1,160 @@
+//-----------------------------------------------------------------------------
+//   File: blocking_bench.cpp
+//
+//	 Function: main
+//-----------------------------------------------------------------------------
+#include "../BlockingQueue.h"
+#include <algorithm>
+#include <chrono>
+#include <string>
+#include <thread>
+#include <vector>
+//-------------------------------------------------------------------------------------------
+//    Function:			main()
+//
+//    File:             blocking_bench.cpp
+//
+//    Title:            Blocking Queue Latency Benchmark
+//
+//    Description:		Producers push timestamps in bursts with short
+//						pauses and consumers record how long each one
+//						waited in the queue. CBlockingQueue is compared with
+//						the usual wrapper of a CQueue, one mutex and one
+//						condition variable notified with notify_all on
+//						every push, at several producer and consumer counts
+//
+//    Programmer:		Reinaldo Daniswara
+//
+//    Date:             10/17/2026
+//
+//    Version:          1.0
+//
+//    Environment:   Intel COre i7
+//						Software: MS Windows 10 for execution;
+//						Compiles under Microsoft Visual Studio 2015
+//
+//    Input:			argv[1] -- elements per producer, 50000 by default
+//
+//    Output:			CSV on cout: queue,producers,consumers,p50_us,
+//						p99_us,max_us,mops where mops is millions of
+//						elements per second end to end
+//
+//    Calls:            CBlockingQueue
+//
+//    Called By:		n/a
+//
+//    Parameters:		int argc, char* argv[]
+//
+//    Returns:          EXIT_SUCCESS  = successful
+//					    EXIT_FAILURE = elements were lost
+//
+//    History Log:
+//                          10/17/2026  RD  completed version 1.0
+// ----------------------------------------------------------------------------
+
+typedef long long stamp; // steady_clock nanoseconds
+
+stamp now_ns()
+{
+	return chrono::duration_cast<chrono::nanoseconds>(chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+// the hand-rolled wrapper: every push wakes every consumer
+class naive_queue
+{
+public:
+	naive_queue() : m_closed(false) {}
+	bool push(stamp x)
+	{
+		{
+			lock_guard<mutex> guard(m_lock);
+			m_items.push(x);
+		}
+		m_ready.notify_all();
+		return true;
+	}
+	bool pop_wait(stamp& out)
+	{
+		unique_lock<mutex> guard(m_lock);
+		m_ready.wait(guard, [this]() { return !m_items.empty() || m_closed; });
+		if (m_items.empty())
+			return false;
+		out = m_items.pop();
+		return true;
+	}
+	void close()
+	{
+		{
+			lock_guard<mutex> guard(m_lock);
+			m_closed = true;
+		}
+		m_ready.notify_all();
+	}
+private:
+	mutex m_lock;
+	condition_variable m_ready;
+	RD_ADT::CQueue<stamp, allocator<stamp> > m_items;
+	bool m_closed;
+};
+
+template <class Q>
+bool run(const char* name, unsigned producers, unsigned consumers, size_t per_producer)
+{
+	Q q;
+	vector<vector<stamp> > latency(consumers);
+	vector<thread> threads;
+	stamp start = now_ns();
+	for (unsigned c = 0; c < consumers; c++)
+		threads.emplace_back([&q, &latency, c, per_producer, producers]()
+		{
+			latency[c].reserve(per_producer * producers / 2);
+			stamp sent;
+			while (q.pop_wait(sent))
+				latency[c].push_back(now_ns() - sent);
+		});
+	vector<thread> senders;
+	for (unsigned p = 0; p < producers; p++)
+		senders.emplace_back([&q, per_producer]()
+		{
+			for (size_t i = 0; i < per_producer; i++)
+			{
+				q.push(now_ns());
+				if (i % 32 == 31)
+					this_thread::sleep_for(chrono::microseconds(50));
+			}
+		});
+	for (thread& t : senders)
+		t.join();
+	q.close();
+	for (thread& t : threads)
+		t.join();
+	double seconds = (now_ns() - start) / 1e9;
+
+	vector<stamp> all;
+	for (vector<stamp>& l : latency)
+		all.insert(all.end(), l.begin(), l.end());
+	if (all.size() != per_producer * producers)
+		return false;
+	sort(all.begin(), all.end());
+	cout << name << ',' << producers << ',' << consumers << ','
+		<< all[all.size() / 2] / 1000.0 << ',' << all[all.size() * 99 / 100] / 1000.0 << ','
+		<< all.back() / 1000.0 << ',' << all.size() / seconds / 1e6 << '\n';
+	return true;
+}
+
+int main(int argc, char* argv[])
+{
+	size_t n = argc > 1 ? stoul(argv[1]) : 50000;
+	cout << "queue,producers,consumers,p50_us,p99_us,max_us,mops\n";
+	unsigned shapes[][2] = { { 1, 1 }, { 1, 4 }, { 4, 4 }, { 4, 16 } };
+	for (auto& shape : shapes)
+	{
+		if (!run<naive_queue>("notify_all_wrapper", shape[0], shape[1], n)
+			|| !run<RD_ADT::CBlockingQueue<stamp> >("CBlockingQueue", shape[0], shape[1], n))
+		{
+			cerr << "elements lost\n";
+			return EXIT_FAILURE;
+		}
+	}
+	return EXIT_SUCCESS;
+}
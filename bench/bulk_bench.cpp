@@ -0,0 +1,105 @@
+//-----------------------------------------------------------------------------
+//   File: bulk_bench.cpp
+//
+//	 Function: main
+//-----------------------------------------------------------------------------
+#include "../list.h"
+#include <chrono>
+#include <list>
+#include <string>
+#include <vector>
+//-------------------------------------------------------------------------------------------
+//    Function:			main()
+//
+//    File:             bulk_bench.cpp
+//
+//    Title:            Whole-list Operation Benchmark
+//
+//    Description:		Times the list-wide operations, fill construction,
+//						copy construction, copy assignment over a list of
+//						the same size and release, for list<int> and a
+//						16-byte POD struct against std::list and std::vector
+//
+//    Programmer:		Reinaldo Daniswara
+//
+//    Date:             10/17/2026
+//
+//    Version:          1.0
+//
+//    Environment:   Intel COre i7
+//						Software: MS Windows 10 for execution;
+//						Compiles under Microsoft Visual Studio 2015
+//
+//    Input:			argv[1] -- elements, 1000000 by default
+//
+//    Output:			CSV on cout: container,payload,operation,ns_per_element,
+//						the best of several runs
+//
+//    Calls:            list, std::list, std::vector
+//
+//    Called By:		n/a
+//
+//    Parameters:		int argc, char* argv[]
+//
+//    Returns:          EXIT_SUCCESS
+//
+//    History Log:
+//                          10/17/2026  RD  completed version 1.0
+// ----------------------------------------------------------------------------
+
+struct point
+{
+	int x, y, z, w;
+};
+
+template <class T> T make(int i);
+template <> int make<int>(int i) { return i; }
+template <> point make<point>(int i) { return point{ i, i, i, i }; }
+
+long long sink = 0; // keeps results alive
+
+template <class C> size_t count(const C& c) { return c.size(); }
+
+template <class C, class T>
+void run(const char* name, const char* payload, size_t n)
+{
+	const int runs = 5;
+	double fill = 1e300, copy = 1e300, assign = 1e300, release = 1e300;
+	for (int r = 0; r < runs; ++r)
+	{
+		chrono::steady_clock::time_point t0 = chrono::steady_clock::now();
+		C* a = new C(n, make<T>(r));
+		chrono::steady_clock::time_point t1 = chrono::steady_clock::now();
+		C* b = new C(*a);
+		chrono::steady_clock::time_point t2 = chrono::steady_clock::now();
+		*a = *b;
+		chrono::steady_clock::time_point t3 = chrono::steady_clock::now();
+		sink += static_cast<long long>(count(*a) + count(*b));
+		delete a;
+		chrono::steady_clock::time_point t4 = chrono::steady_clock::now();
+		delete b;
+
+		fill = min(fill, chrono::duration<double, nano>(t1 - t0).count() / n);
+		copy = min(copy, chrono::duration<double, nano>(t2 - t1).count() / n);
+		assign = min(assign, chrono::duration<double, nano>(t3 - t2).count() / n);
+		release = min(release, chrono::duration<double, nano>(t4 - t3).count() / n);
+	}
+	cout << name << ',' << payload << ",fill," << fill << '\n';
+	cout << name << ',' << payload << ",copy," << copy << '\n';
+	cout << name << ',' << payload << ",assign," << assign << '\n';
+	cout << name << ',' << payload << ",release," << release << '\n';
+}
+
+int main(int argc, char* argv[])
+{
+	size_t n = argc > 1 ? stoul(argv[1]) : 1000000;
+
+	cout << "container,payload,operation,ns_per_element\n";
+	run<RD_ADT::list<int>, int>("RD_ADT::list", "int", n);
+	run<std::list<int>, int>("std::list", "int", n);
+	run<vector<int>, int>("std::vector", "int", n);
+	run<RD_ADT::list<point>, point>("RD_ADT::list", "point", n);
+	run<std::list<point>, point>("std::list", "point", n);
+	run<vector<point>, point>("std::vector", "point", n);
+	return EXIT_SUCCESS;
+}
@@ -0,0 +1,108 @@
+//-----------------------------------------------------------------------------
+//   File: footprint_bench.cpp
+//
+//	 Function: main
+//-----------------------------------------------------------------------------
+#include "../list.h"
+#include "../UnrolledList.h"
+#include "../CompactList.h"
+#include <chrono>
+#include <cstdlib>
+#include <list>
+#include <new>
+#include <string>
+
+long long heap_bytes = 0; // requested through operator new
+long long heap_blocks = 0;
+
+void* operator new(size_t n)
+{
+	heap_bytes += static_cast<long long>(n);
+	heap_blocks++;
+	void* p = malloc(n == 0 ? 1 : n);
+	if (p == nullptr)
+		throw bad_alloc();
+	return p;
+}
+void operator delete(void* p) noexcept { free(p); }
+void operator delete(void* p, size_t) noexcept { free(p); }
+
+//-------------------------------------------------------------------------------------------
+//    Function:			main()
+//
+//    File:             footprint_bench.cpp
+//
+//    Title:            Per-element Memory Footprint Benchmark
+//
+//    Description:		Fills std::list<int>, list<int> on new/delete and on
+//						the pool, unrolled_list<int> and compact_list<int>
+//						with n ints and reports the heap bytes each one
+//						requested per element, the number of heap blocks,
+//						and the time to fill and to scan it. Bytes are what
+//						operator new was asked for; malloc adds its own
+//						header, about 16 bytes, to every block on top.
+//
+//    Programmer:		Reinaldo Daniswara
+//
+//    Date:             10/17/2026
+//
+//    Version:          1.0
+//
+//    Environment:   Intel COre i7
+//						Software: MS Windows 10 for execution;
+//						Compiles under Microsoft Visual Studio 2015
+//
+//    Input:			argv[1] -- elements, 10000000 by default
+//
+//    Output:			CSV on cout: container,elements,bytes_per_element,
+//						heap_blocks,fill_ns,scan_ns (both per element)
+//
+//    Calls:            list classes, std::list
+//
+//    Called By:		n/a
+//
+//    Parameters:		int argc, char* argv[]
+//
+//    Returns:          EXIT_SUCCESS
+//
+//    History Log:
+//                          10/17/2026  RD  completed version 1.0
+// ----------------------------------------------------------------------------
+
+long long sink = 0; // keeps results alive
+
+template <class C>
+void measure(const char* name, size_t n)
+{
+	long long bytes = heap_bytes;
+	long long blocks = heap_blocks;
+	chrono::steady_clock::time_point start = chrono::steady_clock::now();
+	{
+		C c;
+		for (size_t i = 0; i < n; ++i)
+			c.push_back(static_cast<int>(i));
+		chrono::steady_clock::time_point filled = chrono::steady_clock::now();
+		bytes = heap_bytes - bytes;
+		blocks = heap_blocks - blocks;
+		for (int x : c)
+			sink += x;
+		chrono::steady_clock::time_point scanned = chrono::steady_clock::now();
+		cout << name << ',' << n << ',' << static_cast<double>(bytes) / n << ',' << blocks << ','
+			<< chrono::duration<double, nano>(filled - start).count() / n << ','
+			<< chrono::duration<double, nano>(scanned - filled).count() / n << '\n';
+	}
+}
+
+int main(int argc, char* argv[])
+{
+	size_t n = argc > 1 ? stoul(argv[1]) : 10000000;
+
+	cout << "container,elements,bytes_per_element,heap_blocks,fill_ns,scan_ns\n";
+	// the pool keeps its blocks once carved, so it goes first, into a cold pool
+	measure<RD_ADT::list<int> >("RD_ADT::list_pool", n);
+	measure<RD_ADT::list<int, allocator<int> > >("RD_ADT::list_new_delete", n);
+	measure<std::list<int> >("std::list", n);
+	measure<RD_ADT::unrolled_list<int> >("RD_ADT::unrolled_list", n);
+	measure<RD_ADT::compact_list<int> >("RD_ADT::compact_list", n);
+	return EXIT_SUCCESS;
+}
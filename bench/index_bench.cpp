@@ -0,0 +1,92 @@
+//-----------------------------------------------------------------------------
+//   File: index_bench.cpp
+//
+//	 Function: main
+//-----------------------------------------------------------------------------
+#include "../list.h"
+#include <chrono>
+#include <random>
+#include <vector>
+//-------------------------------------------------------------------------------------------
+//    Function:			main()
+//
+//    File:             index_bench.cpp
+//
+//    Title:            list::operator[] Benchmark
+//
+//    Description:		Times list<int>::operator[] for sequential forward,
+//						sequential negative and random index patterns over
+//						a range of list sizes
+//
+//    Programmer:		Reinaldo Daniswara
+//
+//    Date:             10/17/2026
+//
+//    Version:          1.0
+//
+//    Environment:   Intel COre i7
+//						Software: MS Windows 10 for execution;
+//						Compiles under Microsoft Visual Studio 2015
+//
+//    Input:			None
+//
+//    Output:			CSV on cout: size,pattern,ns_per_access
+//
+//    Calls:            list classes and related functions
+//
+//    Called By:		n/a
+//
+//    Parameters:		None
+//
+//    Returns:          EXIT_SUCCESS
+//
+//    History Log:
+//                          10/17/2026  RD  completed version 1.0
+// ----------------------------------------------------------------------------
+
+int main(void)
+{
+	using RD_ADT::list;
+	typedef chrono::steady_clock clock_type;
+
+	const int accesses = 1 << 20;
+	mt19937 gen(42);
+	long long sink = 0;
+
+	cout << "size,pattern,ns_per_access\n";
+	for (int size = 1 << 8; size <= 1 << 18; size <<= 2)
+	{
+		list<int> l;
+		for (int i = 0; i < size; ++i)
+			l.push_back(i);
+
+		vector<int> randomIndex(accesses);
+		uniform_int_distribution<int> dist(-size, size - 1);
+		for (int& i : randomIndex)
+			i = dist(gen);
+
+		clock_type::time_point start = clock_type::now();
+		for (int i = 0; i < accesses; ++i)
+			sink += l[i % size];
+		double forward = chrono::duration<double, nano>(clock_type::now() - start).count();
+
+		start = clock_type::now();
+		for (int i = 0; i < accesses; ++i)
+			sink += l[-1 - i % size];
+		double negative = chrono::duration<double, nano>(clock_type::now() - start).count();
+
+		// random access is linear in size, so keep the run time bounded
+		int randomCount = accesses / (size / 256);
+		start = clock_type::now();
+		for (int i = 0; i < randomCount; ++i)
+			sink += l[randomIndex[i]];
+		double random = chrono::duration<double, nano>(clock_type::now() - start).count();
+
+		cout << size << ",sequential," << forward / accesses << '\n';
+		cout << size << ",negative," << negative / accesses << '\n';
+		cout << size << ",random," << random / randomCount << '\n';
+	}
+
+	cerr << "checksum " << sink << '\n';
+	return EXIT_SUCCESS;
+}
@@ -0,0 +1,113 @@
+//-----------------------------------------------------------------------------
+//   File: intrusive_bench.cpp
+//
+//	 Function: main
+//-----------------------------------------------------------------------------
+#include "../IntrusiveList.h"
+#include "../Queue.h"
+#include <chrono>
+#include <string>
+#include <vector>
+//-------------------------------------------------------------------------------------------
+//    Function:			main()
+//
+//    File:             intrusive_bench.cpp
+//
+//    Title:            Intrusive Queue Benchmark
+//
+//    Description:		Queues objects the caller already owns, a 64-byte
+//						order record, through CQueue holding copies, CQueue
+//						holding pointers and CIntrusiveQueue linking the
+//						records themselves; each round pushes every record
+//						and pops them all, touching each popped record
+//
+//    Programmer:		Reinaldo Daniswara
+//
+//    Date:             10/17/2026
+//
+//    Version:          1.0
+//
+//    Environment:   Intel COre i7
+//						Software: MS Windows 10 for execution;
+//						Compiles under Microsoft Visual Studio 2015
+//
+//    Input:			argv[1] -- records, 100000 by default
+//
+//    Output:			CSV on cout: queue,records,ns_per_record, the best of
+//						several rounds
+//
+//    Calls:            CQueue, CIntrusiveQueue
+//
+//    Called By:		n/a
+//
+//    Parameters:		int argc, char* argv[]
+//
+//    Returns:          EXIT_SUCCESS
+//
+//    History Log:
+//                          10/17/2026  RD  completed version 1.0
+// ----------------------------------------------------------------------------
+
+struct order
+{
+	long long id;
+	double price;
+	char symbol[32];
+	RD_ADT::list_hook<order> hook;
+};
+
+long long sink = 0; // keeps results alive
+
+template <class F>
+double ns_per_record(size_t records, F round)
+{
+	const int rounds = 7;
+	double best = 1e300;
+	for (int r = 0; r < rounds; ++r)
+	{
+		chrono::steady_clock::time_point start = chrono::steady_clock::now();
+		round();
+		double ns = chrono::duration<double, nano>(chrono::steady_clock::now() - start).count() / records;
+		if (ns < best)
+			best = ns;
+	}
+	return best;
+}
+
+int main(int argc, char* argv[])
+{
+	using namespace RD_ADT;
+	size_t records = argc > 1 ? stoul(argv[1]) : 100000;
+	vector<order> orders(records);
+	for (size_t i = 0; i < records; ++i)
+		orders[i].id = static_cast<long long>(i);
+
+	cout << "queue,records,ns_per_record\n";
+	CQueue<order> copies;
+	cout << "CQueue_copies," << records << ',' << ns_per_record(records, [&]()
+	{
+		for (order& o : orders)
+			copies.push(o);
+		while (!copies.empty())
+			sink += copies.pop().id;
+	}) << '\n';
+
+	CQueue<order*> pointers;
+	cout << "CQueue_pointers," << records << ',' << ns_per_record(records, [&]()
+	{
+		for (order& o : orders)
+			pointers.push(&o);
+		while (!pointers.empty())
+			sink += pointers.pop()->id;
+	}) << '\n';
+
+	CIntrusiveQueue<order, &order::hook> linked;
+	cout << "CIntrusiveQueue," << records << ',' << ns_per_record(records, [&]()
+	{
+		for (order& o : orders)
+			linked.push(o);
+		while (!linked.empty())
+			sink += linked.pop().id;
+	}) << '\n';
+	return EXIT_SUCCESS;
+}
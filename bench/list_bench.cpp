@@ -0,0 +1,298 @@
+//-----------------------------------------------------------------------------
+//   File: list_bench.cpp
+//
+//	 Function: main
+//-----------------------------------------------------------------------------
+#include "../list.h"
+#include "../Queue.h"
+#include <chrono>
+#include <deque>
+#include <list>
+#include <string>
+#include <vector>
+//-------------------------------------------------------------------------------------------
+//    Function:			main()
+//
+//    File:             list_bench.cpp
+//
+//    Title:            Container Microbenchmark Suite
+//
+//    Description:		Times the list and CQueue operations against
+//						std::list, std::deque and std::vector for int, a
+//						short string and a 256-byte struct at several sizes
+//
+//    Programmer:		Reinaldo Daniswara
+//
+//    Date:             10/17/2026
+//
+//    Version:          1.0
+//
+//    Environment:   Intel COre i7
+//						Software: MS Windows 10 for execution;
+//						Compiles under Microsoft Visual Studio 2015
+//
+//    Input:			argv[1] -- "json" for JSON lines, CSV otherwise
+//
+//    Output:			one record per container, payload, size and
+//						operation with the best ns per element of several runs
+//
+//    Calls:            list classes and std containers
+//
+//    Called By:		n/a
+//
+//    Parameters:		int argc, char* argv[]
+//
+//    Returns:          EXIT_SUCCESS
+//
+//    History Log:
+//                          10/17/2026  RD  completed version 1.0
+// ----------------------------------------------------------------------------
+
+struct large_payload
+{
+	int key;
+	char bytes[252];
+	large_payload(int k = 0) : key(k) { bytes[0] = static_cast<char>(k); }
+};
+
+template <class T> T make(int i);
+template <> int make<int>(int i) { return i; }
+template <> string make<string>(int i) { return "sushi" + to_string(i % 1000); }
+template <> large_payload make<large_payload>(int i) { return large_payload(i); }
+
+long long weigh(int x) { return x; }
+long long weigh(const string& x) { return static_cast<long long>(x.size()); }
+long long weigh(const large_payload& x) { return x.key; }
+
+long long sink = 0; // keeps results alive
+
+//-----------------------------------------------------------------------------
+//	  adapters, one per container, giving every container the same surface
+//-----------------------------------------------------------------------------
+
+template <class T>
+struct rd_list
+{
+	typedef RD_ADT::list<T> type;
+	static const char* name() { return "RD_ADT::list"; }
+	static const bool has_front = true;
+	static void push_front(type& c, const T& x) { c.push_front(x); }
+	static void push_back(type& c, const T& x) { c.push_back(x); }
+	static void pop_front(type& c) { c.pop_front(); }
+	static void pop_back(type& c) { c.pop_back(); }
+	static const T& at(const type& c, int i) { return c[i]; }
+	static size_t size(const type& c) { return c.getSize(); }
+	static void clear(type& c) { c.release(); }
+	template <class F>
+	static void scan(const type& c, F f)
+	{
+		for (const T& x : c)
+			f(x);
+	}
+};
+
+template <class T, class C, const char* Name, bool Front>
+struct std_container
+{
+	typedef C type;
+	static const char* name() { return Name; }
+	static const bool has_front = Front;
+	static void push_front(type& c, const T& x) { c.push_front(x); }
+	static void push_back(type& c, const T& x) { c.push_back(x); }
+	static void pop_front(type& c) { c.pop_front(); }
+	static void pop_back(type& c) { c.pop_back(); }
+	static const T& at(const type& c, int i)
+	{
+		typename type::const_iterator it = c.begin();
+		advance(it, i); // O(1) for deque and vector, a walk for std::list
+		return *it;
+	}
+	static size_t size(const type& c) { return c.size(); }
+	static void clear(type& c) { c.clear(); }
+	template <class F>
+	static void scan(const type& c, F f)
+	{
+		for (const T& x : c)
+			f(x);
+	}
+};
+
+extern const char std_list_name[] = "std::list";
+extern const char std_deque_name[] = "std::deque";
+extern const char std_vector_name[] = "std::vector";
+
+//-----------------------------------------------------------------------------
+//	  timing and reporting
+//-----------------------------------------------------------------------------
+
+struct reporter
+{
+	bool json;
+	void row(const char* container, const char* payload, int size, const char* op, double ns)
+	{
+		if (json)
+			cout << "{\"container\":\"" << container << "\",\"payload\":\"" << payload
+				<< "\",\"size\":" << size << ",\"operation\":\"" << op
+				<< "\",\"ns_per_element\":" << ns << "}\n";
+		else
+			cout << container << ',' << payload << ',' << size << ',' << op << ',' << ns << '\n';
+	}
+};
+
+// best of several runs of f, which touches n elements per run
+template <class F>
+double best_ns(int n, F f)
+{
+	const int runs = 5;
+	double best = 1e300;
+	for (int r = 0; r < runs; ++r)
+	{
+		chrono::steady_clock::time_point start = chrono::steady_clock::now();
+		f();
+		double ns = chrono::duration<double, nano>(chrono::steady_clock::now() - start).count();
+		if (ns < best)
+			best = ns;
+	}
+	return best / n;
+}
+
+// as best_ns, but each run first builds a fresh container from prototype
+// outside the timed region and hands it to f
+template <class C, class F>
+double best_ns_on_copy(int n, const C& prototype, F f)
+{
+	const int runs = 5;
+	double best = 1e300;
+	for (int r = 0; r < runs; ++r)
+	{
+		C work(prototype);
+		chrono::steady_clock::time_point start = chrono::steady_clock::now();
+		f(work);
+		double ns = chrono::duration<double, nano>(chrono::steady_clock::now() - start).count();
+		if (ns < best)
+			best = ns;
+	}
+	return best / n;
+}
+
+template <class T, class A>
+void bench_container(reporter& out, const char* payload, int size)
+{
+	typedef typename A::type C;
+	const char* name = A::name();
+
+	if constexpr (A::has_front)
+	{
+		out.row(name, payload, size, "push_front", best_ns(size, [&]() {
+			C c;
+			for (int i = 0; i < size; ++i)
+				A::push_front(c, make<T>(i));
+			sink += static_cast<long long>(A::size(c));
+		}));
+	}
+	out.row(name, payload, size, "push_back", best_ns(size, [&]() {
+		C c;
+		for (int i = 0; i < size; ++i)
+			A::push_back(c, make<T>(i));
+		sink += static_cast<long long>(A::size(c));
+	}));
+
+	C filled;
+	for (int i = 0; i < size; ++i)
+		A::push_back(filled, make<T>(i));
+
+	if constexpr (A::has_front)
+	{
+		out.row(name, payload, size, "pop_front", best_ns_on_copy(size, filled, [&](C& work) {
+			for (int i = 0; i < size; ++i)
+				A::pop_front(work);
+		}));
+	}
+	out.row(name, payload, size, "pop_back", best_ns_on_copy(size, filled, [&](C& work) {
+		for (int i = 0; i < size; ++i)
+			A::pop_back(work);
+	}));
+
+	// indexed access walks are quadratic for linked containers, cap the count
+	int probes = size < 1024 ? size : 1024;
+	out.row(name, payload, size, "index_sequential", best_ns(probes, [&]() {
+		for (int i = 0; i < probes; ++i)
+			sink += weigh(A::at(filled, i));
+	}));
+	out.row(name, payload, size, "index_strided", best_ns(probes, [&]() {
+		for (int i = 0; i < probes; ++i)
+			sink += weigh(A::at(filled, static_cast<int>((i * 7919LL) % size)));
+	}));
+
+	out.row(name, payload, size, "iterate", best_ns(size, [&]() {
+		A::scan(filled, [](const T& x) { sink += weigh(x); });
+	}));
+	out.row(name, payload, size, "copy_construct", best_ns(size, [&]() {
+		C c(filled);
+		sink += static_cast<long long>(A::size(c));
+	}));
+	out.row(name, payload, size, "copy_assign", best_ns(size, [&]() {
+		C c;
+		A::push_back(c, make<T>(0));
+		c = filled;
+		sink += static_cast<long long>(A::size(c));
+	}));
+	out.row(name, payload, size, "release", best_ns_on_copy(size, filled, [&](C& work) {
+		A::clear(work);
+	}));
+}
+
+template <class T>
+void bench_queue(reporter& out, const char* payload, int size)
+{
+	out.row("RD_ADT::CQueue", payload, size, "push_pop_cycle", best_ns(size, [&]() {
+		RD_ADT::CQueue<T> q;
+		for (int i = 0; i < 16; ++i)
+			q.push(make<T>(i));
+		for (int i = 0; i < size; ++i)
+		{
+			q.push(make<T>(i));
+			sink += weigh(q.pop());
+		}
+	}));
+	out.row("std::deque", payload, size, "push_pop_cycle", best_ns(size, [&]() {
+		deque<T> q;
+		for (int i = 0; i < 16; ++i)
+			q.push_back(make<T>(i));
+		for (int i = 0; i < size; ++i)
+		{
+			q.push_back(make<T>(i));
+			sink += weigh(q.front());
+			q.pop_front();
+		}
+	}));
+}
+
+template <class T>
+void bench_payload(reporter& out, const char* payload)
+{
+	const int sizes[] = { 1000, 10000, 100000 };
+	for (int size : sizes)
+	{
+		bench_container<T, rd_list<T> >(out, payload, size);
+		bench_container<T, std_container<T, std::list<T>, std_list_name, true> >(out, payload, size);
+		bench_container<T, std_container<T, deque<T>, std_deque_name, true> >(out, payload, size);
+		bench_container<T, std_container<T, vector<T>, std_vector_name, false> >(out, payload, size);
+		bench_queue<T>(out, payload, size);
+	}
+}
+
+int main(int argc, char* argv[])
+{
+	reporter out;
+	out.json = argc > 1 && string(argv[1]) == "json";
+	if (!out.json)
+		cout << "container,payload,size,operation,ns_per_element\n";
+
+	bench_payload<int>(out, "int");
+	bench_payload<string>(out, "small_string");
+	bench_payload<large_payload>(out, "large_struct");
+
+	cerr << "checksum " << sink << '\n';
+	return EXIT_SUCCESS;
+}
@@ -0,0 +1,131 @@
+//-----------------------------------------------------------------------------
+//   File: lru_bench.cpp
+//
+//	 Function: main
+//-----------------------------------------------------------------------------
+#include "../LRUCache.h"
+#include <chrono>
+#include <list>
+#include <random>
+#include <string>
+#include <unordered_map>
+#include <vector>
+//-------------------------------------------------------------------------------------------
+//    Function:			main()
+//
+//    File:             lru_bench.cpp
+//
+//    Title:            LRU Cache Benchmark
+//
+//    Description:		Replays one skewed stream of get-or-put requests
+//						through LRUCache and through the usual std::list
+//						plus std::unordered_map of list iterators, at a few
+//						capacities, and checks both see the same hits
+//
+//    Programmer:		Reinaldo Daniswara
+//
+//    Date:             10/17/2026
+//
+//    Version:          1.0
+//
+//    Environment:   Intel COre i7
+//						Software: MS Windows 10 for execution;
+//						Compiles under Microsoft Visual Studio 2015
+//
+//    Input:			argv[1] -- number of requests, 4000000 by default
+//
+//    Output:			CSV on cout: cache,capacity,ns_per_request,hit_rate
+//
+//    Calls:            LRUCache
+//
+//    Called By:		n/a
+//
+//    Parameters:		int argc, char* argv[]
+//
+//    Returns:          EXIT_SUCCESS  = successful
+//					    EXIT_FAILURE = the two caches disagree
+//
+//    History Log:
+//                          10/17/2026  RD  completed version 1.0
+// ----------------------------------------------------------------------------
+
+// the textbook LRU: a list for the order, a hash map of list iterators
+class std_lru
+{
+public:
+	explicit std_lru(size_t capacity) : m_capacity(capacity) { m_index.reserve(capacity); }
+	long long* get(long long key)
+	{
+		auto it = m_index.find(key);
+		if (it == m_index.end())
+			return nullptr;
+		m_order.splice(m_order.begin(), m_order, it->second);
+		return &it->second->second;
+	}
+	void put(long long key, long long value)
+	{
+		if (m_order.size() >= m_capacity)
+		{
+			m_index.erase(m_order.back().first);
+			m_order.pop_back();
+		}
+		m_order.emplace_front(key, value);
+		m_index[key] = m_order.begin();
+	}
+private:
+	size_t m_capacity;
+	std::list<pair<long long, long long> > m_order;
+	unordered_map<long long, std::list<pair<long long, long long> >::iterator> m_index;
+};
+
+template <class Cache>
+double replay(Cache& cache, const std::vector<long long>& keys, size_t& hits)
+{
+	hits = 0;
+	chrono::steady_clock::time_point start = chrono::steady_clock::now();
+	for (long long key : keys)
+	{
+		if (long long* v = cache.get(key))
+		{
+			hits++;
+			*v += 1;
+		}
+		else
+			cache.put(key, key);
+	}
+	return chrono::duration<double, nano>(chrono::steady_clock::now() - start).count() / keys.size();
+}
+
+int main(int argc, char* argv[])
+{
+	size_t n = argc > 1 ? stoul(argv[1]) : 4000000;
+	mt19937_64 rng(99);
+
+	// squaring a uniform draw skews requests toward small keys
+	const double universe = 1 << 20;
+	std::vector<long long> keys(n);
+	uniform_real_distribution<double> u(0.0, 1.0);
+	for (long long& k : keys)
+	{
+		double x = u(rng);
+		k = static_cast<long long>(x * x * universe);
+	}
+
+	cout << "cache,capacity,ns_per_request,hit_rate\n";
+	for (size_t capacity : { 1000, 30000, 300000 })
+	{
+		size_t std_hits, rd_hits;
+		std_lru reference(capacity);
+		double std_ns = replay(reference, keys, std_hits);
+		RD_ADT::LRUCache<long long, long long> cache(capacity);
+		double rd_ns = replay(cache, keys, rd_hits);
+		if (std_hits != rd_hits || rd_hits != cache.hits())
+		{
+			cerr << "hit mismatch " << std_hits << " != " << rd_hits << '\n';
+			return EXIT_FAILURE;
+		}
+		cout << "std_lru," << capacity << ',' << std_ns << ',' << static_cast<double>(std_hits) / n << '\n';
+		cout << "RD_ADT::LRUCache," << capacity << ',' << rd_ns << ',' << cache.hit_rate() << '\n';
+	}
+	return EXIT_SUCCESS;
+}
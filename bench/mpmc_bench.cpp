@@ -0,0 +1,138 @@
+//-----------------------------------------------------------------------------
+//   File: mpmc_bench.cpp
+//
+//	 Function: main
+//-----------------------------------------------------------------------------
+#include "../Queue.h"
+#include "../ConcurrentQueue.h"
+#include <chrono>
+#include <mutex>
+#include <thread>
+#include <vector>
+//-------------------------------------------------------------------------------------------
+//    Function:			main()
+//
+//    File:             mpmc_bench.cpp
+//
+//    Title:            Multi-Producer Multi-Consumer Queue Benchmark
+//
+//    Description:		Moves a fixed number of ints through CConcurrentQueue
+//						and through a CQueue guarded by one mutex, scaling
+//						producers and consumers from 1 to the core count
+//
+//    Programmer:		Reinaldo Daniswara
+//
+//    Date:             10/17/2026
+//
+//    Version:          1.0
+//
+//    Environment:   Intel COre i7
+//						Software: MS Windows 10 for execution;
+//						Compiles under Microsoft Visual Studio 2015
+//
+//    Input:			None
+//
+//    Output:			CSV on cout: queue,producers,consumers,mops_per_sec
+//
+//    Calls:            CConcurrentQueue, CQueue
+//
+//    Called By:		n/a
+//
+//    Parameters:		None
+//
+//    Returns:          EXIT_SUCCESS  = successful
+//					    EXIT_FAILURE = lost or duplicated items
+//
+//    History Log:
+//                          10/17/2026  RD  completed version 1.0
+// ----------------------------------------------------------------------------
+
+// CQueue with one mutex around every call, the setup being replaced
+class locked_queue
+{
+public:
+	void push(int x) { lock_guard<mutex> guard(m); q.push(x); }
+	bool try_pop(int& out)
+	{
+		lock_guard<mutex> guard(m);
+		if (q.empty())
+			return false;
+		out = q.pop();
+		return true;
+	}
+private:
+	mutex m;
+	RD_ADT::CQueue<int, std::allocator<int> > q;
+};
+
+template <class Queue>
+double run(Queue& q, int producers, int consumers, int items)
+{
+	atomic<long long> sum(0);
+	atomic<int> consumed(0);
+	vector<thread> threads;
+	int per_producer = items / producers;
+	int total = per_producer * producers;
+
+	chrono::steady_clock::time_point start = chrono::steady_clock::now();
+	for (int p = 0; p < producers; ++p)
+		threads.emplace_back([&q, p, per_producer]() {
+			for (int i = 0; i < per_producer; ++i)
+				q.push(p * per_producer + i);
+		});
+	for (int c = 0; c < consumers; ++c)
+		threads.emplace_back([&q, &sum, &consumed, total]() {
+			long long local = 0;
+			int x;
+			while (consumed.load(memory_order_relaxed) < total)
+			{
+				if (q.try_pop(x))
+				{
+					local += x;
+					consumed.fetch_add(1, memory_order_relaxed);
+				}
+				else
+					this_thread::yield();
+			}
+			sum += local;
+		});
+	for (thread& t : threads)
+		t.join();
+	double seconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+
+	long long expected = static_cast<long long>(total) * (total - 1) / 2;
+	if (sum.load() != expected)
+		throw runtime_error("items lost or duplicated");
+	return total / seconds / 1e6;
+}
+
+int main(void)
+{
+	const int items = 1 << 21;
+	int cores = static_cast<int>(thread::hardware_concurrency());
+	if (cores < 2)
+		cores = 2;
+
+	try
+	{
+		cout << "queue,producers,consumers,mops_per_sec\n";
+		for (int producers = 1; producers <= cores; producers *= 2)
+		{
+			for (int consumers = 1; consumers <= cores; consumers *= 2)
+			{
+				RD_ADT::CConcurrentQueue<int> lockfree;
+				cout << "lockfree," << producers << ',' << consumers << ','
+					<< run(lockfree, producers, consumers, items) << '\n';
+				locked_queue locked;
+				cout << "mutex," << producers << ',' << consumers << ','
+					<< run(locked, producers, consumers, items) << '\n';
+			}
+		}
+	}
+	catch (exception& e)
+	{
+		cerr << "benchmark failed: " << e.what() << endl;
+		return EXIT_FAILURE;
+	}
+	return EXIT_SUCCESS;
+}
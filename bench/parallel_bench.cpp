@@ -0,0 +1,187 @@
+//-----------------------------------------------------------------------------
+//   File: parallel_bench.cpp
+//
+//	 Function: main
+//-----------------------------------------------------------------------------
+#include "../ParallelAlgorithms.h"
+#include <chrono>
+#include <cmath>
+#include <string>
+#include <vector>
+//-------------------------------------------------------------------------------------------
+//    Function:			main()
+//
+//    File:             parallel_bench.cpp
+//
+//    Title:            Parallel Algorithms Benchmark
+//
+//    Description:		Times for_each, transform, reduce, count_if and
+//						find_if over a large list on 1 to the core count
+//						threads, against a sequential iterator::operator++
+//						walk. Each parallel algorithm is timed twice: cutting
+//						the list into segments on every call, and reusing
+//						segments built once
+//
+//    Programmer:		Reinaldo Daniswara
+//
+//    Date:             10/17/2026
+//
+//    Version:          1.0
+//
+//    Environment:   Intel COre i7
+//						Software: MS Windows 10 for execution;
+//						Compiles under Microsoft Visual Studio 2015
+//
+//    Input:			argv[1] -- number of elements, 4000000 by default
+//
+//    Output:			CSV on cout: algorithm,threads,segments,ms,speedup
+//						where speedup is against the sequential walk
+//
+//    Calls:            parallel algorithms, list
+//
+//    Called By:		n/a
+//
+//    Parameters:		int argc, char* argv[]
+//
+//    Returns:          EXIT_SUCCESS  = successful
+//					    EXIT_FAILURE = a parallel result differs
+//
+//    History Log:
+//                          10/17/2026  RD  completed version 1.0
+// ----------------------------------------------------------------------------
+
+long long sink = 0; // keeps results alive
+
+// a few hundred cycles of arithmetic, so the walk is not the whole cost
+double heavy(double x)
+{
+	for (int i = 0; i < 16; ++i)
+		x = sqrt(x * x + 1.0) * 0.999;
+	return x;
+}
+
+template <class F>
+double best_ms(F f)
+{
+	const int runs = 5;
+	double best = 1e300;
+	for (int r = 0; r < runs; ++r)
+	{
+		chrono::steady_clock::time_point start = chrono::steady_clock::now();
+		f();
+		double ms = chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
+		if (ms < best)
+			best = ms;
+	}
+	return best;
+}
+
+struct reporter
+{
+	void row(const char* algorithm, unsigned threads, const char* segments, double ms, double sequential_ms)
+	{
+		cout << algorithm << ',' << threads << ',' << segments << ',' << ms << ',' << sequential_ms / ms << '\n';
+	}
+};
+
+int main(int argc, char* argv[])
+{
+	using namespace RD_ADT;
+	size_t n = argc > 1 ? stoul(argv[1]) : 4000000;
+
+	list<double> data;
+	for (size_t i = 0; i < n; ++i)
+		data.push_back(static_cast<double>(i % 1000));
+	const double target = -1.0; // find_if scans the whole list
+	auto is_target = [target](double x) { return x == target; };
+	auto is_small = [](double x) { return x < 100.0; };
+	auto plus = [](double a, double b) { return a + b; };
+
+	// sequential baselines
+	double seq_for_each = best_ms([&]() {
+		for (list<double>::iterator it = data.begin(); it != data.end(); ++it)
+			*it = heavy(*it);
+	});
+	double seq_reduce = best_ms([&]() {
+		double acc = 0;
+		for (list<double>::iterator it = data.begin(); it != data.end(); ++it)
+			acc += *it;
+		sink += static_cast<long long>(acc);
+	});
+	double seq_count = best_ms([&]() {
+		size_t c = 0;
+		for (list<double>::iterator it = data.begin(); it != data.end(); ++it)
+			if (is_small(*it))
+				c++;
+		sink += c;
+	});
+	double seq_find = best_ms([&]() {
+		list<double>::iterator it = data.begin();
+		while (it != data.end() && !is_target(*it))
+			++it;
+		sink += it == data.end();
+	});
+
+	reporter out;
+	cout << "algorithm,threads,segments,ms,speedup\n";
+	out.row("for_each", 1, "sequential", seq_for_each, seq_for_each);
+	out.row("reduce", 1, "sequential", seq_reduce, seq_reduce);
+	out.row("count_if", 1, "sequential", seq_count, seq_count);
+	out.row("find_if", 1, "sequential", seq_find, seq_find);
+
+	unsigned cores = thread::hardware_concurrency();
+	if (cores == 0)
+		cores = 1;
+	vector<unsigned> counts;
+	for (unsigned threads = 1; threads < cores; threads *= 2)
+		counts.push_back(threads);
+	counts.push_back(cores);
+	for (unsigned threads : counts)
+	{
+		thread_pool pool(threads - 1);
+		auto seg = segment(data, segment_parts(pool));
+
+		out.row("for_each", threads, "per_call", best_ms([&]() {
+			parallel_for_each(pool, data, [](double& x) { x = heavy(x); });
+		}), seq_for_each);
+		out.row("for_each", threads, "reused", best_ms([&]() {
+			parallel_for_each(pool, seg, [](double& x) { x = heavy(x); });
+		}), seq_for_each);
+		out.row("transform", threads, "reused", best_ms([&]() {
+			parallel_transform(pool, seg, [](double x) { return heavy(x); });
+		}), seq_for_each);
+
+		double expected = 0;
+		for (double x : data)
+			expected += x;
+		double got = 0;
+		out.row("reduce", threads, "per_call", best_ms([&]() {
+			got = parallel_reduce(pool, data, 0.0, plus);
+		}), seq_reduce);
+		out.row("reduce", threads, "reused", best_ms([&]() {
+			got = parallel_reduce(pool, seg, 0.0, plus);
+		}), seq_reduce);
+		if (fabs(got - expected) > 1e-6 * fabs(expected) + 1e-9)
+		{
+			cerr << "reduce mismatch " << got << " != " << expected << '\n';
+			return EXIT_FAILURE;
+		}
+
+		out.row("count_if", threads, "per_call", best_ms([&]() {
+			sink += parallel_count_if(pool, data, is_small);
+		}), seq_count);
+		out.row("count_if", threads, "reused", best_ms([&]() {
+			sink += parallel_count_if(pool, seg, is_small);
+		}), seq_count);
+
+		out.row("find_if", threads, "per_call", best_ms([&]() {
+			sink += parallel_find_if(pool, data, is_target) == data.end();
+		}), seq_find);
+		out.row("find_if", threads, "reused", best_ms([&]() {
+			sink += parallel_find_if(pool, seg, is_target) == data.end();
+		}), seq_find);
+	}
+
+	cerr << "checksum " << sink << '\n';
+	return EXIT_SUCCESS;
+}
@@ -0,0 +1,87 @@
+//-----------------------------------------------------------------------------
+//   File: small_bench.cpp
+//
+//	 Function: main
+//-----------------------------------------------------------------------------
+#include "../Queue.h"
+#include <chrono>
+#include <memory>
+#include <string>
+//-------------------------------------------------------------------------------------------
+//    Function:			main()
+//
+//    File:             small_bench.cpp
+//
+//    Title:            Short-lived Queue Benchmark
+//
+//    Description:		Builds a queue, pushes k items, pops them all and
+//						destroys the queue, many times over, for CQueue on
+//						plain new/delete, CQueue on the default pool and
+//						small_queue with 8 inline cells
+//
+//    Programmer:		Reinaldo Daniswara
+//
+//    Date:             10/17/2026
+//
+//    Version:          1.0
+//
+//    Environment:   Intel COre i7
+//						Software: MS Windows 10 for execution;
+//						Compiles under Microsoft Visual Studio 2015
+//
+//    Input:			argv[1] -- queues built per run, 1000000 by default
+//
+//    Output:			CSV on cout: queue,items,ns_per_queue, the best of
+//						several runs
+//
+//    Calls:            CQueue, small_queue
+//
+//    Called By:		n/a
+//
+//    Parameters:		int argc, char* argv[]
+//
+//    Returns:          EXIT_SUCCESS
+//
+//    History Log:
+//                          10/17/2026  RD  completed version 1.0
+// ----------------------------------------------------------------------------
+
+long long sink = 0; // keeps results alive
+
+template <class Queue>
+double ns_per_queue(size_t queues, int items)
+{
+	const int runs = 5;
+	double best = 1e300;
+	for (int r = 0; r < runs; ++r)
+	{
+		chrono::steady_clock::time_point start = chrono::steady_clock::now();
+		for (size_t q = 0; q < queues; ++q)
+		{
+			Queue queue;
+			for (int i = 0; i < items; ++i)
+				queue.push(static_cast<int>(q) + i);
+			while (!queue.empty())
+				sink += queue.pop();
+		}
+		double ns = chrono::duration<double, nano>(chrono::steady_clock::now() - start).count() / queues;
+		if (ns < best)
+			best = ns;
+	}
+	return best;
+}
+
+int main(int argc, char* argv[])
+{
+	using namespace RD_ADT;
+	size_t queues = argc > 1 ? stoul(argv[1]) : 1000000;
+
+	cout << "queue,items,ns_per_queue\n";
+	for (int items = 1; items <= 32; items *= 2)
+	{
+		cout << "CQueue_new_delete," << items << ',' << ns_per_queue<CQueue<int, allocator<int> > >(queues, items) << '\n';
+		cout << "CQueue_pool," << items << ',' << ns_per_queue<CQueue<int> >(queues, items) << '\n';
+		cout << "small_queue_8," << items << ',' << ns_per_queue<small_queue<int, 8> >(queues, items) << '\n';
+	}
+	return EXIT_SUCCESS;
+}
@@ -0,0 +1,145 @@
+//-----------------------------------------------------------------------------
+//   File: sort_bench.cpp
+//
+//	 Function: main
+//-----------------------------------------------------------------------------
+#include "../ParallelAlgorithms.h"
+#include <algorithm>
+#include <chrono>
+#include <list>
+#include <random>
+#include <string>
+#include <vector>
+//-------------------------------------------------------------------------------------------
+//    Function:			main()
+//
+//    File:             sort_bench.cpp
+//
+//    Title:            List Sort Benchmark
+//
+//    Description:		Sorts the same random ints and strings with
+//						std::list::sort, list::sort, parallel_sort on 1 to
+//						the core count threads, and the old way of copying
+//						into a vector, std::stable_sort and rebuilding the
+//						list with push_back. Lists are filled in an
+//						interleaved order so their cells are scattered as
+//						after a long run of inserts and removals
+//
+//    Programmer:		Reinaldo Daniswara
+//
+//    Date:             10/17/2026
+//
+//    Version:          1.0
+//
+//    Environment:   Intel COre i7
+//						Software: MS Windows 10 for execution;
+//						Compiles under Microsoft Visual Studio 2015
+//
+//    Input:			argv[1] -- number of elements, 1000000 by default
+//
+//    Output:			CSV on cout: type,method,threads,ms,vs_std_list
+//						where vs_std_list is std::list::sort's time over
+//						this one's
+//
+//    Calls:            list::sort, parallel_sort
+//
+//    Called By:		n/a
+//
+//    Parameters:		int argc, char* argv[]
+//
+//    Returns:          EXIT_SUCCESS  = successful
+//					    EXIT_FAILURE = a result is not sorted like std::list
+//
+//    History Log:
+//                          10/17/2026  RD  completed version 1.0
+// ----------------------------------------------------------------------------
+
+template <class L>
+void fill(L& l, const std::vector<typename L::value_type>& keys)
+{
+	// every other key goes to the front, scattering neighbours in memory
+	for (size_t i = 0; i < keys.size(); ++i)
+		if (i % 2 == 0)
+			l.push_back(keys[i]);
+		else
+			l.push_front(keys[i]);
+}
+
+template <class L, class F>
+double time_sort(const std::vector<typename L::value_type>& keys, F sort, std::vector<typename L::value_type>& result)
+{
+	const int runs = 3;
+	double best = 1e300;
+	for (int r = 0; r < runs; ++r)
+	{
+		L l;
+		fill(l, keys);
+		chrono::steady_clock::time_point start = chrono::steady_clock::now();
+		sort(l);
+		double ms = chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
+		if (ms < best)
+			best = ms;
+		result.assign(l.begin(), l.end());
+	}
+	return best;
+}
+
+template <class T>
+bool run(const char* type, const std::vector<T>& keys)
+{
+	typedef RD_ADT::list<T> rd_list;
+	std::vector<T> expected, got;
+	double base = time_sort<std::list<T> >(keys, [](std::list<T>& l) { l.sort(); }, expected);
+	cout << type << ",std::list::sort,1," << base << ",1\n";
+
+	double ms = time_sort<rd_list>(keys, [](rd_list& l) { l.sort(); }, got);
+	cout << type << ",list::sort,1," << ms << ',' << base / ms << '\n';
+	if (got != expected)
+		return false;
+
+	ms = time_sort<rd_list>(keys, [](rd_list& l)
+	{
+		std::vector<T> v(l.begin(), l.end());
+		std::stable_sort(v.begin(), v.end());
+		l.release();
+		for (T& x : v)
+			l.push_back(std::move(x));
+	}, got);
+	cout << type << ",vector_rebuild,1," << ms << ',' << base / ms << '\n';
+
+	unsigned cores = thread::hardware_concurrency();
+	if (cores == 0)
+		cores = 1;
+	for (unsigned threads = 2; ; threads = threads * 2 < cores ? threads * 2 : cores)
+	{
+		RD_ADT::thread_pool pool(threads - 1);
+		ms = time_sort<rd_list>(keys, [&pool](rd_list& l) { RD_ADT::parallel_sort(pool, l); }, got);
+		cout << type << ",parallel_sort," << threads << ',' << ms << ',' << base / ms << '\n';
+		if (got != expected)
+			return false;
+		if (threads >= cores)
+			break;
+	}
+	return true;
+}
+
+int main(int argc, char* argv[])
+{
+	size_t n = argc > 1 ? stoul(argv[1]) : 1000000;
+	mt19937 rng(12345);
+
+	std::vector<int> ints(n);
+	for (int& x : ints)
+		x = static_cast<int>(rng() % (n / 2 + 1)); // repeats, so stability matters
+	std::vector<string> strings(n / 4);
+	for (string& s : strings)
+		s = "key" + to_string(rng() % (n / 8 + 1)) + string(rng() % 24, 'x');
+
+	cout << "type,method,threads,ms,vs_std_list\n";
+	if (!run("int", ints) || !run("string", strings))
+	{
+		cerr << "sort mismatch\n";
+		return EXIT_FAILURE;
+	}
+	return EXIT_SUCCESS;
+}
@@ -0,0 +1,97 @@
+//-----------------------------------------------------------------------------
+//   File: spill_bench.cpp
+//
+//	 Function: main
+//-----------------------------------------------------------------------------
+#include "../SpillQueue.h"
+#include <chrono>
+#include <string>
+//-------------------------------------------------------------------------------------------
+//    Function:			main()
+//
+//    File:             spill_bench.cpp
+//
+//    Title:            Spilling Queue Burst Benchmark
+//
+//    Description:		Pushes one burst of ints and then drains it, through
+//						a plain CQueue and through CSpillQueue with a
+//						memory budget, and reports the time per element for
+//						each phase and the most elements held in memory
+//
+//    Programmer:		Reinaldo Daniswara
+//
+//    Date:             10/17/2026
+//
+//    Version:          1.0
+//
+//    Environment:   Intel COre i7
+//						Software: MS Windows 10 for execution;
+//						Compiles under Microsoft Visual Studio 2015
+//
+//    Input:			argv[1] -- burst size, 10000000 by default
+//						argv[2] -- memory budget, 1000000 by default
+//						argv[3] -- segment directory, spill_bench.segments
+//								   by default; removed afterwards
+//
+//    Output:			CSV on cout: queue,elements,peak_in_memory,push_ns,pop_ns
+//
+//    Calls:            CQueue, CSpillQueue
+//
+//    Called By:		n/a
+//
+//    Parameters:		int argc, char* argv[]
+//
+//    Returns:          EXIT_SUCCESS  = successful
+//					    EXIT_FAILURE = an element came back out of order
+//
+//    History Log:
+//                          10/17/2026  RD  completed version 1.0
+// ----------------------------------------------------------------------------
+
+double ns_since(chrono::steady_clock::time_point start, size_t n)
+{
+	return chrono::duration<double, nano>(chrono::steady_clock::now() - start).count() / n;
+}
+
+int main(int argc, char* argv[])
+{
+	using namespace RD_ADT;
+	size_t n = argc > 1 ? stoul(argv[1]) : 10000000;
+	size_t budget = argc > 2 ? stoul(argv[2]) : 1000000;
+	string directory = argc > 3 ? argv[3] : "spill_bench.segments";
+
+	cout << "queue,elements,peak_in_memory,push_ns,pop_ns\n";
+	{
+		CQueue<int> q;
+		chrono::steady_clock::time_point start = chrono::steady_clock::now();
+		for (size_t i = 0; i < n; i++)
+			q.push(static_cast<int>(i));
+		double push = ns_since(start, n);
+		size_t peak = q.getSize();
+		start = chrono::steady_clock::now();
+		for (size_t i = 0; i < n; i++)
+			if (q.pop() != static_cast<int>(i))
+				return EXIT_FAILURE;
+		cout << "CQueue," << n << ',' << peak << ',' << push << ',' << ns_since(start, n) << '\n';
+	}
+	{
+		filesystem::remove_all(directory);
+		CSpillQueue<int> q(directory, budget);
+		size_t peak = 0;
+		chrono::steady_clock::time_point start = chrono::steady_clock::now();
+		for (size_t i = 0; i < n; i++)
+		{
+			q.push(static_cast<int>(i));
+			if (q.in_memory() > peak)
+				peak = q.in_memory();
+		}
+		double push = ns_since(start, n);
+		start = chrono::steady_clock::now();
+		for (size_t i = 0; i < n; i++)
+			if (q.pop() != static_cast<int>(i))
+				return EXIT_FAILURE;
+		cout << "CSpillQueue," << n << ',' << peak << ',' << push << ',' << ns_since(start, n) << '\n';
+	}
+	filesystem::remove_all(directory);
+	return EXIT_SUCCESS;
+}
@@ -0,0 +1,170 @@
+//-----------------------------------------------------------------------------
+//   File: steal_bench.cpp
+//
+//	 Function: main
+//-----------------------------------------------------------------------------
+#include "../ForkJoin.h"
+#include <chrono>
+#include <cmath>
+#include <string>
+#include <vector>
+//-------------------------------------------------------------------------------------------
+//    Function:			main()
+//
+//    File:             steal_bench.cpp
+//
+//    Title:            Work Stealing Scaling Benchmark
+//
+//    Description:		Runs one divide and conquer batch job, a range of
+//						small CPU bound leaves split in halves as tasks, on
+//						1 to the core count threads: through thread_pool,
+//						where every task goes through its single shared
+//						CQueue, and through fork_join_pool, where tasks stay
+//						on their worker's deque unless stolen
+//
+//    Programmer:		Reinaldo Daniswara
+//
+//    Date:             10/17/2026
+//
+//    Version:          1.0
+//
+//    Environment:   Intel COre i7
+//						Software: MS Windows 10 for execution;
+//						Compiles under Microsoft Visual Studio 2015
+//
+//    Input:			argv[1] -- number of leaves, 262144 by default
+//						argv[2] -- arithmetic steps per leaf, 64 by default
+//
+//    Output:			CSV on cout: executor,threads,ms,speedup where
+//						speedup is against the same executor on 1 thread
+//
+//    Calls:            thread_pool, fork_join_pool
+//
+//    Called By:		n/a
+//
+//    Parameters:		int argc, char* argv[]
+//
+//    Returns:          EXIT_SUCCESS  = successful
+//					    EXIT_FAILURE = a leaf was lost
+//
+//    History Log:
+//                          10/17/2026  RD  completed version 1.0
+// ----------------------------------------------------------------------------
+
+size_t steps = 64;
+
+double leaf(size_t i)
+{
+	double x = static_cast<double>(i);
+	for (size_t k = 0; k < steps; ++k)
+		x = sqrt(x * x + 1.0) * 0.999;
+	return x;
+}
+
+template <class F>
+double best_ms(F f)
+{
+	const int runs = 3;
+	double best = 1e300;
+	for (int r = 0; r < runs; ++r)
+	{
+		chrono::steady_clock::time_point start = chrono::steady_clock::now();
+		f();
+		double ms = chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
+		if (ms < best)
+			best = ms;
+	}
+	return best;
+}
+
+// every split goes through the pool's one locked queue
+struct shared_job
+{
+	RD_ADT::thread_pool& pool;
+	atomic<size_t> left;
+	atomic<long long> sum;
+	mutex lock;
+	condition_variable done;
+
+	void split(size_t lo, size_t hi)
+	{
+		while (hi - lo > 1)
+		{
+			size_t mid = lo + (hi - lo) / 2;
+			pool.submit([this, mid, hi]() { split(mid, hi); });
+			hi = mid;
+		}
+		sum += static_cast<long long>(leaf(lo));
+		if (--left == 0)
+		{
+			lock_guard<mutex> guard(lock);
+			done.notify_one();
+		}
+	}
+};
+
+int main(int argc, char* argv[])
+{
+	using namespace RD_ADT;
+	size_t n = argc > 1 ? stoul(argv[1]) : 262144;
+	if (argc > 2)
+		steps = stoul(argv[2]);
+
+	long long expected = 0;
+	for (size_t i = 0; i < n; ++i)
+		expected += static_cast<long long>(leaf(i));
+
+	unsigned cores = thread::hardware_concurrency();
+	if (cores == 0)
+		cores = 1;
+	vector<unsigned> counts;
+	for (unsigned threads = 1; threads < cores; threads *= 2)
+		counts.push_back(threads);
+	counts.push_back(cores);
+
+	cout << "executor,threads,ms,speedup\n";
+	double shared_base = 0, steal_base = 0;
+	for (unsigned threads : counts)
+	{
+		long long got = 0;
+		double ms;
+		{
+			thread_pool pool(threads); // the caller only waits
+			ms = best_ms([&]()
+			{
+				shared_job job{ pool, { n }, { 0 }, {}, {} };
+				job.split(0, n);
+				unique_lock<mutex> guard(job.lock);
+				job.done.wait(guard, [&job]() { return job.left.load() == 0; });
+				got = job.sum;
+			});
+		}
+		if (got != expected)
+		{
+			cerr << "shared queue lost leaves\n";
+			return EXIT_FAILURE;
+		}
+		if (threads == 1)
+			shared_base = ms;
+		cout << "shared_CQueue," << threads << ',' << ms << ',' << shared_base / ms << '\n';
+
+		{
+			fork_join_pool pool(threads - 1); // the caller helps
+			ms = best_ms([&]()
+			{
+				atomic<long long> sum(0);
+				pool.run(n, [&sum](size_t i) { sum += static_cast<long long>(leaf(i)); });
+				got = sum;
+			});
+		}
+		if (got != expected)
+		{
+			cerr << "work stealing lost leaves\n";
+			return EXIT_FAILURE;
+		}
+		if (threads == 1)
+			steal_base = ms;
+		cout << "work_stealing," << threads << ',' << ms << ',' << steal_base / ms << '\n';
+	}
+	return EXIT_SUCCESS;
+}
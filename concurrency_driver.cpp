@@ -0,0 +1,302 @@
+//-----------------------------------------------------------------------------
+//   File: concurrency_driver.cpp
+//
+//	 Function: main
+//-----------------------------------------------------------------------------
+#include "ConcurrentQueue.h"
+#include "BlockingQueue.h"
+#include "ForkJoin.h"
+#ifdef __cpp_impl_coroutine
+#include "AsyncQueue.h"
+#endif
+#include <atomic>
+#include <iostream>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+//-------------------------------------------------------------------------------------------
+//    Function:			main()
+//
+//    File:             concurrency_driver.cpp
+//
+//    Title:            Concurrent Queue and Executor Driver
+//
+//    Description:		Runs several producers against several consumers on
+//						CConcurrentQueue (and so hazard_domain), on a
+//						bounded CBlockingQueue with single and bulk calls,
+//						and on CAsyncQueue with coroutine consumers when the
+//						compiler has coroutines; then runs nested and
+//						concurrent jobs on fork_join_pool. Every value must
+//						arrive exactly once, checked by count and sum, and
+//						values of one producer must reach a consumer in the
+//						order they were pushed.
+//
+//    Programmer:		Reinaldo Daniswara
+//
+//    Date:             10/17/2026
+//
+//    Version:          1.0
+//
+//    Environment:   Intel COre i7
+//						Software: MS Windows 10 for execution;
+//						Compiles under Microsoft Visual Studio 2015
+//
+//    Input:			None
+//
+//    Output:			one line per check on cout, ok or FAILED
+//
+//    Calls:            CConcurrentQueue, CBlockingQueue, CAsyncQueue,
+//						fork_join_pool, task_group
+//
+//    Called By:		n/a
+//
+//    Parameters:		None
+//
+//    Returns:          EXIT_SUCCESS  = every check passed
+//					    EXIT_FAILURE = a value was lost, duplicated or
+//									   reordered, or a sum was wrong
+//
+//    History Log:
+//                          10/17/2026  RD  completed version 1.0
+// ----------------------------------------------------------------------------
+
+using namespace RD_ADT;
+
+const int producers = 4;
+const int consumers = 4;
+const int per_producer = 100000;
+const long long total = static_cast<long long>(producers) * per_producer;
+
+// what the consumers of one run saw; producer p pushes
+// p * per_producer + 1 .. (p + 1) * per_producer in that order
+struct tally
+{
+	atomic<long long> count{ 0 };
+	atomic<long long> sum{ 0 };
+	atomic<bool> ordered{ true };
+
+	// one consumer's view: the last value it took from each producer
+	struct seen
+	{
+		long long last[producers] = {};
+		void take(tally& t, long long v)
+		{
+			int p = static_cast<int>((v - 1) / per_producer);
+			if (v <= last[p])
+				t.ordered = false;
+			last[p] = v;
+			t.count.fetch_add(1, memory_order_relaxed);
+			t.sum.fetch_add(v, memory_order_relaxed);
+		}
+	};
+
+	bool matches() const { return count == total && sum == total * (total + 1) / 2 && ordered; }
+};
+
+bool report(const char* name, bool ok)
+{
+	cout << name << (ok ? ": ok" : ": FAILED") << '\n';
+	return ok;
+}
+
+template <class Queue>
+void produce(vector<thread>& threads, Queue& q)
+{
+	for (int p = 0; p < producers; p++)
+		threads.emplace_back([&q, p]()
+		{
+			for (int i = 1; i <= per_producer; i++)
+				q.push(static_cast<long long>(p) * per_producer + i);
+		});
+}
+
+bool concurrent_queue()
+{
+	CConcurrentQueue<long long> q;
+	tally t;
+	vector<thread> threads;
+	produce(threads, q);
+	for (int c = 0; c < consumers; c++)
+		threads.emplace_back([&q, &t]()
+		{
+			tally::seen s;
+			long long v;
+			while (t.count.load() < total)
+			{
+				if (q.try_pop(v))
+					s.take(t, v);
+				else
+					this_thread::yield();
+			}
+		});
+	for (thread& th : threads)
+		th.join();
+	return t.matches() && q.empty() && q.getSize() == 0;
+}
+
+bool blocking_queue()
+{
+	CBlockingQueue<long long> q(256);
+	tally t;
+	vector<thread> threads;
+	for (int p = 0; p < producers; p++)
+		threads.emplace_back([&q, p]()
+		{
+			long long v = static_cast<long long>(p) * per_producer + 1;
+			for (int i = 0; i < per_producer;)
+			{
+				if (i % 2 == 0)
+				{
+					q.push(v++);
+					i++;
+					continue;
+				}
+				CBlockingQueue<long long>::batch_type batch;
+				for (int k = 0; k < 8 && i < per_producer; k++, i++)
+					batch.push_back(v++);
+				q.push_bulk(std::move(batch));
+			}
+		});
+	for (int c = 0; c < consumers; c++)
+		threads.emplace_back([&q, &t, c]()
+		{
+			tally::seen s;
+			long long v;
+			CBlockingQueue<long long>::batch_type batch;
+			for (;;)
+			{
+				if (c % 2 == 0)
+				{
+					if (!q.pop_wait(v))
+						break;
+					s.take(t, v);
+				}
+				else
+				{
+					if (q.pop_bulk_wait(batch, 16) == 0)
+						break;
+					while (!batch.empty())
+						s.take(t, batch.pop_front());
+				}
+			}
+		});
+	for (int p = 0; p < producers; p++)
+		threads[p].join();
+	q.close();
+	for (int c = 0; c < consumers; c++)
+		threads[producers + c].join();
+	return t.matches() && q.empty();
+}
+
+// sum of lo .. hi - 1, the upper half as a task of a group
+long long range_sum(fork_join_pool& pool, long long lo, long long hi)
+{
+	if (hi - lo <= 1000)
+	{
+		long long s = 0;
+		for (long long i = lo; i < hi; i++)
+			s += i;
+		return s;
+	}
+	long long mid = lo + (hi - lo) / 2;
+	long long upper = 0;
+	task_group g(pool);
+	g.spawn([&pool, &upper, mid, hi]() { upper = range_sum(pool, mid, hi); });
+	long long lower = range_sum(pool, lo, mid);
+	g.wait();
+	return lower + upper;
+}
+
+bool fork_join()
+{
+	fork_join_pool pool(3);
+	const long long n = 1000000;
+	bool ok = range_sum(pool, 0, n) == n * (n - 1) / 2;
+
+	// outside threads submitting at once go through the injection queue
+	atomic<long long> sums[producers];
+	vector<thread> threads;
+	for (int p = 0; p < producers; p++)
+	{
+		sums[p] = 0;
+		threads.emplace_back([&pool, &sums, p]()
+		{
+			pool.run(static_cast<size_t>(per_producer), [&sums, p](size_t i)
+			{
+				sums[p].fetch_add(static_cast<long long>(i) + 1, memory_order_relaxed);
+			});
+		});
+	}
+	for (thread& th : threads)
+		th.join();
+	for (int p = 0; p < producers; p++)
+		ok = ok && sums[p] == static_cast<long long>(per_producer) * (per_producer + 1) / 2;
+
+	bool rethrown = false;
+	try
+	{
+		pool.run(1000, [](size_t i) { if (i == 500) throw runtime_error("task failed"); });
+	}
+	catch (runtime_error&)
+	{
+		rethrown = true;
+	}
+	return ok && rethrown;
+}
+
+#ifdef __cpp_impl_coroutine
+// pops until it sees -1
+async_task async_consumer(CAsyncQueue<long long>& q, tally& t, atomic<int>& finished)
+{
+	tally::seen s;
+	for (;;)
+	{
+		long long v = co_await q.pop();
+		if (v < 0)
+			break;
+		s.take(t, v);
+	}
+	finished.fetch_add(1);
+}
+
+bool async_queue()
+{
+	tally t;
+	atomic<int> finished(0);
+	const int waiters = 16;
+	thread_pool pool(3);
+	pool_executor exec(pool);
+	CAsyncQueue<long long> q(exec);
+	for (int c = 0; c < waiters; c++)
+		spawn(exec, async_consumer(q, t, finished));
+	vector<thread> threads;
+	produce(threads, q);
+	for (thread& th : threads)
+		th.join();
+	for (int c = 0; c < waiters; c++)
+		q.push(-1);
+	while (finished.load() < waiters)
+		this_thread::yield();
+	return t.matches() && q.getSize() == 0;
+}
+#endif
+
+int main(void)
+{
+	bool ok = true;
+	try
+	{
+		ok = report("CConcurrentQueue", concurrent_queue()) && ok;
+		ok = report("CBlockingQueue", blocking_queue()) && ok;
+		ok = report("fork_join_pool", fork_join()) && ok;
+#ifdef __cpp_impl_coroutine
+		ok = report("CAsyncQueue", async_queue()) && ok;
+#endif
+	}
+	catch (exception& e)
+	{
+		cerr << "program terminated: " << e.what() << endl;
+		return EXIT_FAILURE;
+	}
+	return ok ? EXIT_SUCCESS : EXIT_FAILURE;
+}
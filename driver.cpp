@@ -41,6 +41,9 @@
 //
 //    History Log:
 //                          5/19/2016  PB  completed version 1.0
+//                          10/17/2026  RD  iterator loops run to the sentinel end
+//                          10/17/2026  RD  '\n' instead of endl, no flush per line
+//                          10/17/2026  RD  iterates across splice, swap and move
 // ----------------------------------------------------------------------------
 
 int main(void)
@@ -53,89 +56,111 @@ int main(void)
 		list<string> list1;
 		list<string>::iterator it;
 
-		cout << "Push front salmon" << endl;
+		cout << "Push front salmon" << '\n';
 		list1.push_front("salmon");
-		cout << list1 << endl;
+		cout << list1 << '\n';
 
-		cout << "Push front tuna and red snapper in front" << endl;
+		cout << "Push front tuna and red snapper in front" << '\n';
 		list1.push_front("tuna");
 		list1.push_front("red snapper");
-		cout << list1 << endl;
+		cout << list1 << '\n';
 
-		cout << "Add yellowtail at the end (push back)" << endl;
+		cout << "Add yellowtail at the end (push back)" << '\n';
 		list1.push_back("yellowtail");
-		cout << list1 << endl;
+		cout << list1 << '\n';
 		
-		cout << "check the positive index" << endl;
-		cout << "list1 [0] is " << list1[0] << endl;
-		cout << "list1 [2] is " << list1[2] << endl;
-		cout << "The negative index: " << endl;
-		cout << "list1 [-1] is " << list1[-1] << endl;
-		cout << "list1 [-3] is " << list1[-3] << endl << endl;
+		cout << "check the positive index" << '\n';
+		cout << "list1 [0] is " << list1[0] << '\n';
+		cout << "list1 [2] is " << list1[2] << '\n';
+		cout << "The negative index: " << '\n';
+		cout << "list1 [-1] is " << list1[-1] << '\n';
+		cout << "list1 [-3] is " << list1[-3] << "\n\n";
  
 		list<string> list2(list1.begin(), list1.end());
-		cout << "Iterator constructor test (list 2)" << endl; 
-		cout << list2 << endl;
+		cout << "Iterator constructor test (list 2)" << '\n'; 
+		cout << list2 << '\n';
 
 		list2.pop_back();
 		list2.pop_back();
 		list2.pop_back();
 		list2.pop_back();
-		cout << "Remove the all element of list 2 with using pop back : " << endl << list2;
+		cout << "Remove the all element of list 2 with using pop back : " << '\n' << list2;
 
 		list<string> list3 = list1;
-		cout << "Operator = test, copy list 1 into list 3" << endl;
-		cout << list3 << endl;
+		cout << "Operator = test, copy list 1 into list 3" << '\n';
+		cout << list3 << '\n';
 
 		list3.pop_back();
-		cout << "Remove the last element of list 3" << endl << list3;
+		cout << "Remove the last element of list 3" << '\n' << list3;
 
 		list3.pop_front();
-		cout << "Remove the first element of list 3 after pop back" << endl;
-		cout << list3 << endl;
+		cout << "Remove the first element of list 3 after pop back" << '\n';
+		cout << list3 << '\n';
 
 		list3.pop_front();
 		list3.pop_front();
-		cout << "Remove all elements of list 3 using pop front" << endl;
-		cout << list3 << endl;
+		cout << "Remove all elements of list 3 using pop front" << '\n';
+		cout << list3 << '\n';
 
 
 		//test queue
-		cout << "copy list 1 into queue 1" << endl;
+		cout << "copy list 1 into queue 1" << '\n';
 		CQueue<string> queue1(list1);
 		for (it = queue1.begin(); it != queue1.end(); ++it)
 		{
-			cout << *it << endl;
+			cout << *it << '\n';
 		}
-		cout << *it << endl << endl ; //to print out the last element
+		cout << '\n';
 
-		cout << "Iterator constructor test for queue 1" << endl;
+		cout << "Iterator constructor test for queue 1" << '\n';
 		CQueue<string> queue2(queue1.begin(), queue1.end());
 		for (it = queue2.begin(); it != queue2.end(); ++it)
 		{
-			cout << *it << endl;
+			cout << *it << '\n';
 		}
-		cout << *it << endl << endl; //to print out the last element
+		cout << '\n';
 
 		CQueue<string> queue3 = queue2;
-		cout << "Operator = test for queue, queue3 = queue2 : " << endl;
-		cout << queue3 << endl;
+		cout << "Operator = test for queue, queue3 = queue2 : " << '\n';
+		cout << queue3 << '\n';
 		
-		cout << "Add an element at the end of the list" << endl;
+		cout << "Add an element at the end of the list" << '\n';
 		queue3.push(string("Sushi makes me hungry"));
-		cout << queue3 << endl;
+		cout << queue3 << '\n';
 
-		cout << "Remove an element at the end of the list" << endl;
+		cout << "Remove an element at the end of the list" << '\n';
 		queue3.pop();
-		cout << queue3 << endl;
+		cout << queue3 << '\n';
 
-		cout << "Remove all element at the end of the list" << endl;
+		cout << "Remove all element at the end of the list" << '\n';
 		queue3.pop();
 		queue3.pop();
 		queue3.pop();
 		queue3.pop();
 		cout << queue3;
 
+		cout << "Iterate across a splice, a swap and a move" << '\n';
+		list<string> fish(list1.begin(), list1.end());
+		list<string> more;
+		more.push_back("eel");
+		more.push_back("octopus");
+		list<string>::iterator first = more.begin();
+		fish.splice(fish.end(), more);
+		list<string> other;
+		other.swap(fish);
+		list<string> moved(std::move(other));
+		unsigned walked = 0;
+		for (it = first; it != moved.end(); ++it, ++walked)
+			cout << *it << '\n';
+		if (walked != 2)
+			throw runtime_error("iterator lost after splice");
+		walked = 0;
+		for (it = moved.begin(); it != moved.end(); ++it)
+			walked++;
+		if (walked != moved.getSize())
+			throw runtime_error("iterator lost after splice");
+		cout << moved << '\n';
+
 		list1.release();
 		queue1.release();
 		queue2.release();
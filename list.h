@@ -15,37 +15,88 @@
 //     Software: MS Windows 10 for execution;
 //     Compiles under Microsoft Visual Studio 2015
 //
-//   class list:
+//   class list<T, Alloc, Stats>:
+//
+//     Template Parameters:
+//       T -- element type
+//       Alloc -- allocator policy for listelem cells, rebound to listelem;
+//                defaults to pool_allocator<T> (see Pool.h), std::allocator<T>
+//                gives plain new/delete, inline_allocator<T, N> keeps the
+//                first N cells inside the list (see SmallBuffer.h). Cells
+//                are relinked between two lists only if their allocators
+//                compare equal; otherwise the elements are moved into new
+//                cells
+//       Stats -- instrumentation policy, privately inherited (see ListStats.h);
+//                no_stats compiles every hook away, list_counters counts them
 //
 //     Properties:
 //       listelem *head -- front end of list
 //       listelem *tail -- back end of list
 //       unsigned m_size -- number of elements in the list
+//       node_allocator m_alloc -- hands out listelem cells
+//       listelem *m_finger -- last cell reached by non-const operator[], or nullptr
+//       int m_fingerPos -- position of m_finger
 //
 //     Methods:
 // 
 //       inline: 
 //         list() -- construct the empty list
-//         list(size_t n_elements, T datum) -- create a list of a specific size, all elements the same
+//         list(size_t n_elements, const T& datum) -- create a list of a specific size, all elements the same
 //         ~list() { release(); } -- destructor
 //         unsigned getSize()const  -- accessor, returns m_size
-//         iterator begin()const -- returns address of first element
-//         iterator end()const -- returns address of last element
+//         size_t size()const -- m_size, for standard algorithms
+//         iterator begin(), const_iterator begin()const -- first element
+//         iterator end(), const_iterator end()const -- one past the last element
+//         cbegin(), cend() -- const_iterator versions
+//         rbegin(), rend() -- reverse iterators from the tail back to the head
 //         T& front()const  -- returns first element data
 //         T& back()const -- returns last element data
 //         bool empty()const -- true if no elements
+//         void push_front(const T& datum), push_front(T&& datum) -- forward to emplace_front
+//         void push_back(const T& datum), push_back(T&& datum) -- forward to emplace_back
 //
 //       non-inline:
 //         list(const list& x); -- copy constructor
-//         list(iterator b, iterator e) -- constructor using iterators
-//         void push_front(T datum) -- insert element at front of list
-//         T pop_front(); -- removes front element and returns the data from that element
-//         void push_back(T datum) -- insert element at back of list 
-//         T pop_back() -- removes back element and returns the data from that element
-//         void release() -- removes all items from list
-//         list operator=(const list & rlist) -- returns a copy of rlist
+//         list(list&& x); -- move constructor, takes over the cells of x
+//         list(InputIt b, InputIt e) -- copies [b, e) from any input iterators
+//         void emplace_front(Args&&... args) -- insert element built in place at front of list
+//         T pop_front(); -- removes front element and returns the data moved out of it
+//         void emplace_back(Args&&... args) -- insert element built in place at back of list
+//         T pop_back() -- removes back element and returns the data moved out of it
+//         void release() -- frees every cell in one pass, skipping destructors
+//                           for trivially destructible T
+//         void swap(list& x) -- exchanges contents in O(1), O(n) if the allocators differ
+//         list& operator=(const list & rlist) -- becomes a copy of rlist
+//         list& operator=(list && rlist) -- takes over the cells of rlist
 //         T& operator[](int index) -- for l-value
 //         const T& operator[](int index)const -- for r-value
+//         void splice(const_iterator pos, list& x) -- moves all of x in front of pos in O(1)
+//         void splice(const_iterator pos, list& x, const_iterator it) -- moves one cell of x in front of pos
+//         void append(list&& x) -- moves all of x to the back in O(1)
+//         list split_at(const_iterator it) -- detaches it through the tail as a new list
+//         void rotate(const_iterator it) -- makes it the head in O(1)
+//         iterator erase(const_iterator it) -- removes one cell in O(1), returns the next
+//         void sort(Compare comp) -- stable bottom-up merge sort by relinking cells, O(1) extra space
+//         void merge(list&& x, Compare comp) -- merges sorted x into this sorted list
+//         Stats& stats() -- the instrumentation policy, for snapshot/reset
+//
+//       protected non-inline:
+//         void link_back(list& x) -- moves all cells of x to the back in O(1)
+//         list unlink_front(size_t n) -- detaches the first n cells as a new list
+//
+//       private inline:
+//         listelem* create_node(listelem* p, listelem* n, Args&&... args) -- allocates and builds a cell
+//         void destroy_node(listelem* e) -- destroys a cell and returns it to m_alloc
+//
+//       private non-inline:
+//         listelem* locate(int index, int& pos)const -- cell at index, walked from head, tail or m_finger
+//         void link_chain(listelem* pos, listelem* first, listelem* last, size_t n) -- links a chain in front of pos
+//         void unlink_chain(listelem* first, listelem* last, size_t n) -- unlinks a chain, keeps its cells
+//         void relink(listelem* first) -- rebuilds prev links, head and tail from a next chain
+//         static void merge_chains(listelem*& first, listelem* a, listelem* b, Compare& comp) -- merges two next chains
+//         static listelem* concat(listelem* a, listelem* b) -- joins two next chains
+//         void append_chain(size_t n, Source next) -- builds n cells from next() and links them at the back at once
+//         void free_chain(listelem* first, size_t n) -- frees n cells chained by next
 //
 //    Public Nested Structures:
 //
@@ -56,28 +107,51 @@
 //          listelem *next -- forward link
 //          listelem *prev -- backward link
 //        constructor:
-//          listelem(T c, listelem* p, listelem* n, listelem* p) -- struct constructor
+//          listelem(listelem* p, listelem* n, Args&&... args) -- struct constructor, data built from args
 //
-//     class iterator
+//     class basic_iterator<Const> -- bidirectional iterator; iterator is
+//                                    basic_iterator<false>, const_iterator
+//                                    basic_iterator<true>. end() holds a null
+//                                    cell; ++ follows the cell's own next
+//                                    link, which is null only at the tail, so
+//                                    an iterator stays valid through splice,
+//                                    split_at, swap and moves and ends at the
+//                                    end() of the list now holding its cell.
 //        Public Methods
 // 
 //           inline: 
-//            listelem* operator->() -- same as for pointer
-//            T& operator*() -- same as for pointer
-//            operator listelem*() -- conversion
-//            iterator(listelem* p = nullptr) -- constructor
+//            pointer operator->() -- same as for pointer
+//            reference operator*() -- same as for pointer
+//            listelem* node() -- the cell, nullptr at end()
+//            operator const_iterator() -- conversion
+//            operator==, operator!= -- compare cells
+//            basic_iterator(listelem* p, const list* o) -- constructor
 // 
 //           non-inline: 
-//            iterator operator++() -- pre-increment
-//            iterator operator--() -- pre-decrement
-//            iterator operator++(int) -- post-increment
-//            iterator operator--(int) -- post-decrement
+//            basic_iterator& operator++() -- pre-increment, tail steps to end()
+//            basic_iterator& operator--() -- pre-decrement, end() steps to tail
+//            basic_iterator operator++(int) -- post-increment
+//            basic_iterator operator--(int) -- post-decrement
 // 
 //        Private Properties
-//            listelem* ptr -- current listelem or NULL
+//            listelem* ptr -- current listelem, nullptr at end()
+//            const list* owner -- list being walked
 //
 //   History Log:
 //			5/19/2016 RD completed version 1.0
+//			10/17/2026 RD cells come from a pluggable allocator, pooled by default
+//			10/17/2026 RD move semantics, emplace and move-out pops
+//			10/17/2026 RD operator[] starts from a cached finger
+//			10/17/2026 RD O(1) relinking helpers for bulk queue operations
+//			10/17/2026 RD splice, append, split_at and rotate
+//			10/17/2026 RD opt-in instrumentation policy
+//			10/17/2026 RD standard bidirectional iterators with a past-the-end sentinel
+//			10/17/2026 RD operator<< renders through list_formatter (Format.h)
+//			10/17/2026 RD sort and merge by relinking cells
+//			10/17/2026 RD erase at an iterator
+//			10/17/2026 RD relinking falls back to moving elements for unequal allocators
+//			10/17/2026 RD whole-list fill, copy, assign and release without per-element pushes and pops
+//			10/17/2026 RD null-terminated links, iterators survive splice and swap
 //-----------------------------------------------------------------------------
 
 #ifndef LIST_H 
@@ -85,148 +159,302 @@
 #include <iostream>
 #include <cassert>
 #include <exception>
+#include <iterator>
+#include <type_traits>
 #include <cstdlib>
+#include <functional>
+#include <memory>
+#include <stdexcept>
+#include <utility>
+#include "Pool.h"
+#include "SmallBuffer.h"
+#include "ListStats.h"
+#include "Format.h"
 
 using namespace std;
 // namespace std has its own list -- we won't use it here
 namespace RD_ADT
 {
 
-	template <class T>
-
-	class list
+	template <class T, class Alloc = pool_allocator<T>, class Stats = no_stats>
+	class list : private Stats
 	{
 	public:
 		struct listelem; // forward declarations
-		class iterator;
+		template <bool Const> class basic_iterator;
+		typedef basic_iterator<false> iterator;
+		typedef basic_iterator<true> const_iterator;
+		typedef std::reverse_iterator<iterator> reverse_iterator;
+		typedef std::reverse_iterator<const_iterator> const_reverse_iterator;
+		typedef T value_type;
+		typedef T& reference;
+		typedef const T& const_reference;
+		typedef size_t size_type;
+		typedef ptrdiff_t difference_type;
 		// constructors
-		list() : head(nullptr), tail(nullptr), m_size(0) {}
-		list(size_t n_elements, T datum);
+		list() : head(nullptr), tail(nullptr), m_size(0), m_finger(nullptr), m_fingerPos(0) {}
+		list(size_t n_elements, const T& datum);
 		list(const list& x);
-		list(iterator b, iterator e);
+		list(list&& x);
+		template <class InputIt, class = typename iterator_traits<InputIt>::iterator_category>
+		list(InputIt b, InputIt e);
 
 		~list() { release(); }
 		unsigned getSize() const { return m_size; }
-		iterator begin() const { return head; }
-		iterator end() const { return tail; }
-		void push_front(T datum);
+		size_t size() const { return m_size; }
+		iterator begin() { return iterator(head, this); }
+		const_iterator begin() const { return const_iterator(head, this); }
+		iterator end() { return iterator(nullptr, this); }
+		const_iterator end() const { return const_iterator(nullptr, this); }
+		const_iterator cbegin() const { return begin(); }
+		const_iterator cend() const { return end(); }
+		reverse_iterator rbegin() { return reverse_iterator(end()); }
+		const_reverse_iterator rbegin() const { return const_reverse_iterator(end()); }
+		reverse_iterator rend() { return reverse_iterator(begin()); }
+		const_reverse_iterator rend() const { return const_reverse_iterator(begin()); }
+		void push_front(const T& datum) { emplace_front(datum); }
+		void push_front(T&& datum) { emplace_front(std::move(datum)); }
+		template <class... Args>
+		void emplace_front(Args&&... args);
 		T pop_front();
-		void push_back(T datum);
+		void push_back(const T& datum) { emplace_back(datum); }
+		void push_back(T&& datum) { emplace_back(std::move(datum)); }
+		template <class... Args>
+		void emplace_back(Args&&... args);
 		T pop_back();
 		T& front() const { return head->data; }
 		T& back() const { return tail->data; }
 		bool empty()const { return head == nullptr || tail == nullptr; }
-		void release() { while (head != nullptr) pop_front(); }
-		list operator=(const list<T> & rlist);
+		void release();
+		void swap(list& x);
+		list& operator=(const list& rlist);
+		list& operator=(list&& rlist);
 		T& operator[](int index);
 		const T& operator[](int index) const;
+		Stats& stats() { return *this; }
+		const Stats& stats() const { return *this; }
+		void splice(const_iterator pos, list& x);
+		void splice(const_iterator pos, list& x, const_iterator it);
+		void append(list&& x) { link_back(x); }
+		list split_at(const_iterator it);
+		void rotate(const_iterator it);
+		iterator erase(const_iterator it);
+		template <class Compare = less<T> >
+		void sort(Compare comp = Compare());
+		template <class Compare = less<T> >
+		void merge(list&& x, Compare comp = Compare());
 
+	protected:
+		void link_back(list& x);
+		list unlink_front(size_t n);
 
 	private:
+		typedef typename allocator_traits<Alloc>::template rebind_alloc<listelem> node_allocator;
+		typedef allocator_traits<node_allocator> node_traits;
+
+		template <class... Args>
+		listelem* create_node(listelem* p, listelem* n, Args&&... args)
+		{
+			listelem* e = node_traits::allocate(m_alloc, 1);
+			try { node_traits::construct(m_alloc, e, p, n, std::forward<Args>(args)...); }
+			catch (...) { node_traits::deallocate(m_alloc, e, 1); throw; }
+			Stats::on_allocate();
+			return e;
+		}
+		void destroy_node(listelem* e)
+		{
+			node_traits::destroy(m_alloc, e);
+			node_traits::deallocate(m_alloc, e, 1);
+			Stats::on_free();
+		}
+
+		listelem* locate(int index, int& pos) const;
+		void link_chain(listelem* pos, listelem* first, listelem* last, size_t n);
+		void unlink_chain(listelem* first, listelem* last, size_t n);
+		void relink(listelem* first);
+		template <class Compare>
+		static void merge_chains(listelem*& first, listelem* a, listelem* b, Compare& comp);
+		static listelem* concat(listelem* a, listelem* b);
+		template <class Source>
+		void append_chain(size_t n, Source next);
+		void free_chain(listelem* first, size_t n);
+
 		listelem *head;
 		listelem *tail;
 		unsigned m_size; // number of elements in the list 
+		listelem *m_finger; // last cell reached by non-const operator[], or nullptr
+		int m_fingerPos; // position of m_finger
+		node_allocator m_alloc; // hands out listelem cells
 	public:
 		struct listelem // list cell
 		{
 			T data;
 			listelem *next;
 			listelem *prev;
-			listelem(T datum, listelem* p, listelem* n) : data(datum), prev(p), next(n) {} // struct constructor
+			template <class... Args>
+			listelem(listelem* p, listelem* n, Args&&... args) // struct constructor, builds data in place
+				: data(std::forward<Args>(args)...), next(n), prev(p) {}
 		};
-		// scoped within class list !
-		class iterator
+		// scoped within class list ! Const selects const_iterator
+		template <bool Const>
+		class basic_iterator
 		{
 		public:
-			iterator(listelem* p = nullptr) : ptr(p) {}
-			iterator operator++();
-			iterator operator--();
-			iterator operator++(int);
-			iterator operator--(int);
-			listelem* operator->() const { return ptr; }
-			T& operator*() const { return ptr->data; }
-			operator listelem*() const { return ptr; }
+			typedef bidirectional_iterator_tag iterator_category;
+			typedef T value_type;
+			typedef ptrdiff_t difference_type;
+			typedef typename conditional<Const, const T*, T*>::type pointer;
+			typedef typename conditional<Const, const T&, T&>::type reference;
+
+			basic_iterator() : ptr(nullptr), owner(nullptr) {}
+			basic_iterator(listelem* p, const list* o) : ptr(p), owner(o) {}
+			operator basic_iterator<true>() const { return basic_iterator<true>(ptr, owner); }
+			basic_iterator& operator++();
+			basic_iterator& operator--();
+			basic_iterator operator++(int);
+			basic_iterator operator--(int);
+			pointer operator->() const { return &ptr->data; }
+			reference operator*() const { return ptr->data; }
+			listelem* node() const { return ptr; }
+			friend bool operator==(const basic_iterator& a, const basic_iterator& b) { return a.ptr == b.ptr; }
+			friend bool operator!=(const basic_iterator& a, const basic_iterator& b) { return a.ptr != b.ptr; }
 		private:
-			listelem* ptr; //current listelem or nullptr
+			listelem* ptr; // current listelem, nullptr once past the tail
+			const list* owner; // list walked, to step off the tail and back from end()
 		};
 	};
 
-	template <class T>
-	ostream& operator<<(ostream& sout, const list<T>& x);
+	// a list whose first N cells live inside the list object
+	template <class T, size_t N, class Stats = no_stats>
+	using small_list = list<T, inline_allocator<T, N>, Stats>;
+
+	template <class T, class Alloc, class Stats>
+	ostream& operator<<(ostream& sout, const list<T, Alloc, Stats>& x);
 
 	//-----------------------------------------------------------------------------
 	//    Class:			list<T>
-	//	  Method:			list(size_t n_elements, T datum)
+	//	  Method:			list(size_t n_elements, const T& datum)
 	//
-	//	  Description:		Constructor for list<T>
+	//	  Description:		Constructor for list<T>, builds all the cells
+	//						as one chain and links it in once
 	// 
-	//    Calls:            none
+	//    Calls:            append_chain()
 	//    Called By:		main
 	// 
-	//    Parameters:		size_t n_elements, T datum
+	//    Parameters:		size_t n_elements, const T& datum
 	//
 	//    History Log:
 	//                      5/19/2016 RD completed version
+	//                      10/17/2026 RD datum taken by reference
+	//                      10/17/2026 RD one chain instead of n pushes
 	//-----------------------------------------------------------------------------
 
-	template <class T>
-	list<T>::list(size_t n_elements, T datum)
-		:m_size(0), head(nullptr), tail(nullptr)
+	template <class T, class Alloc, class Stats>
+	list<T, Alloc, Stats>::list(size_t n_elements, const T& datum)
+		: head(nullptr), tail(nullptr), m_size(0), m_finger(nullptr), m_fingerPos(0)
 	{
 		if (n_elements <= 0)
 			throw out_of_range("Empty list");
-		for (size_t i = 0; i < n_elements; ++i)
-			push_front(datum);
+		append_chain(n_elements, [&datum]() -> const T& { return datum; });
 	}
 
 	//-----------------------------------------------------------------------------
 	//    Class:			list<T>
 	//	  Method:			list(const list<T>& x)
 	//
-	//	  Description:		Copy constructor for list<T>
+	//	  Description:		Copy constructor for list<T>, builds the copied
+	//						cells as one chain and links it in once
 	// 
-	//    Calls:            none
+	//    Calls:            append_chain()
 	//    Called By:		main
 	// 
 	//    Parameters:		const list<T>& x
 	//
 	//    History Log:
 	//                      5/19/2016 RD completed version
+	//                      10/17/2026 RD range-for over the sentinel end, empty x is fine
+	//                      10/17/2026 RD one chain instead of a push per element
 	//-----------------------------------------------------------------------------
 
-	template <class T>
-	list<T>::list(const list<T>& x)
-		: m_size(0), head(nullptr), tail(nullptr)
+	template <class T, class Alloc, class Stats>
+	list<T, Alloc, Stats>::list(const list<T, Alloc, Stats>& x)
+		: head(nullptr), tail(nullptr), m_size(0), m_finger(nullptr), m_fingerPos(0),
+		m_alloc(node_traits::select_on_container_copy_construction(x.m_alloc))
 	{
-		list<T>::iterator r_it = x.begin();
-		while (r_it != x.end())
-			push_back(*r_it++);
-		push_back(*r_it++);
+		const listelem* from = x.head;
+		append_chain(x.m_size, [&from]() -> const T& { const T& datum = from->data; from = from->next; return datum; });
+		Stats::on_copy(m_size);
+	}
+
+	//-----------------------------------------------------------------------------
+	//    Class:			list<T>
+	//	  Method:			list(list<T>&& x)
+	//
+	//	  Description:		Move constructor for list<T>, takes over the cells
+	//						of x and leaves x empty. Cells are moved one by one
+	//						only when the two allocators cannot share them.
+	// 
+	//    Calls:            push_back(), pop_front()
+	//    Called By:		main
+	// 
+	//    Parameters:		list<T>&& x
+	//
+	//    History Log:
+	//                      10/17/2026 RD completed version
+	//-----------------------------------------------------------------------------
 
+	template <class T, class Alloc, class Stats>
+	list<T, Alloc, Stats>::list(list<T, Alloc, Stats>&& x)
+		: head(nullptr), tail(nullptr), m_size(0), m_finger(nullptr), m_fingerPos(0), m_alloc(std::move(x.m_alloc))
+	{
+		if (m_alloc == x.m_alloc)
+		{
+			head = x.head;
+			tail = x.tail;
+			m_size = x.m_size;
+			m_finger = x.m_finger;
+			m_fingerPos = x.m_fingerPos;
+			x.head = x.tail = x.m_finger = nullptr;
+			x.m_size = 0;
+		}
+		else
+		{
+			while (!x.empty())
+				push_back(x.pop_front());
+		}
 	}
 
 	//-----------------------------------------------------------------------------
 	//    Class:			list<T>
-	//	  Method:			list(iterator b, iterator e)
+	//	  Method:			list(InputIt b, InputIt e)
 	//
-	//	  Description:		constructor using iterators, copies from b to one before e
+	//	  Description:		constructor using iterators, copies from b to one before e;
+	//						forward iterators are counted first and the cells
+	//						built as one chain
 	// 
-	//    Calls:            none
+	//    Calls:            append_chain(), push_back()
 	//    Called By:		main
 	// 
-	//    Parameters:		iterator b, iterator e
+	//    Parameters:		InputIt b, InputIt e -- any input iterators
 	//
 	//    History Log:
 	//                      5/19/2016 RD completed version
+	//                      10/17/2026 RD takes any input iterators, e is past the end
+	//                      10/17/2026 RD forward iterators go through append_chain
 	//-----------------------------------------------------------------------------
 
-	template <class T>
-	list<T>::list(iterator b, iterator e)
-		:m_size(0), head(nullptr), tail(nullptr)
+	template <class T, class Alloc, class Stats>
+	template <class InputIt, class>
+	list<T, Alloc, Stats>::list(InputIt b, InputIt e)
+		: head(nullptr), tail(nullptr), m_size(0), m_finger(nullptr), m_fingerPos(0)
 	{
-		while (b != e)
-			push_back(*b++);
-		push_back(*b++);
+		if constexpr (is_base_of<forward_iterator_tag, typename iterator_traits<InputIt>::iterator_category>::value)
+			append_chain(static_cast<size_t>(distance(b, e)), [&b]() -> decltype(*b) { decltype(*b) datum = *b; ++b; return datum; });
+		else
+		{
+			for (; b != e; ++b)
+				push_back(*b);
+		}
 	}
 
 	//-----------------------------------------------------------------------------
@@ -238,7 +466,7 @@ namespace RD_ADT
 	//				
 	//	  Output:			elements to sout
 	// 
-	//    Calls:            none
+	//    Calls:            print_list()
 	//    Called By:		main
 	// 
 	//    Parameters:		ostream& sout, const list<T>& x
@@ -246,67 +474,63 @@ namespace RD_ADT
 	//
 	//    History Log:
 	//                      5/19/2016 RD completed version
+	//                      10/17/2026 RD stops at the sentinel end
+	//                      10/17/2026 RD formats into one buffer, one write
 	//-----------------------------------------------------------------------------
 
-	template <class T>
-	ostream& operator<<(ostream& sout, const list<T>& x)
+	template <class T, class Alloc, class Stats>
+	ostream& operator<<(ostream& sout, const list<T, Alloc, Stats>& x)
 	{
-		list<T>::iterator p = x.begin(); // gets x.h
-		sout << "(";
-		while (p != x.end())
-		{
-			sout << *p;
-			if (p != nullptr)
-				sout << ", ";
-			++p; // advances iterator using next
-		}
-		if (p != nullptr)
-			sout << *p;
-		sout << ")\n";
-		return sout;
+		return print_list(sout, x);
 	}
 
 	//-----------------------------------------------------------------------------
 	//    Class:			list<T>
-	//	  Method:			push_front(T datum)
+	//	  Method:			emplace_front(Args&&... args)
 	//
-	//	  Description:		insert element at front of list
+	//	  Description:		insert element at front of list, built in place
+	//						from args; push_front(const T&) and push_front(T&&)
+	//						forward here
 	// 
-	//    Calls:            none
-	//    Called By:		main
+	//    Calls:            create_node()
+	//    Called By:		main, push_front()
 	// 
-	//    Parameters:		T datum
+	//    Parameters:		Args&&... args
 	//
 	//    History Log:
 	//                      5/19/2016 RD completed version
+	//                      10/17/2026 RD builds the datum in place
 	//-----------------------------------------------------------------------------
 
-	template <class T>
-	void list<T>::push_front(T datum)
+	template <class T, class Alloc, class Stats>
+	template <class... Args>
+	void list<T, Alloc, Stats>::emplace_front(Args&&... args)
 	{
-		listelem* temp = new listelem(datum, tail, head);
+		listelem* temp = create_node(nullptr, head, std::forward<Args>(args)...);
 
 		if (!empty())
 		{ // was a nonempty list
 			head->prev = temp;
 			head = temp;
+			m_fingerPos++;
 		}
 		else
-		{
 			head = tail = temp;
-			temp->next = tail;
-			temp->next = head;
-		}
 		m_size++;
+		Stats::on_push_front();
+		Stats::on_size(m_size);
 	}
 
 	//-----------------------------------------------------------------------------
 	//    Class:			list<T>
 	//	  Method:			list<T>::operator=(const list & rlist)
 	//
-	//	  Description:		returns a copy of rlist
+	//	  Description:		replaces the contents with a copy of rlist.
+	//						Existing cells are assigned over instead of
+	//						freed, so only the difference in length is
+	//						allocated or freed
 	// 
-	//    Calls:            none
+	//    Calls:            unlink_chain(), free_chain(), append_chain()
 	//    Called By:		n/a
 	// 
 	//    Parameters:		const list & rlist
@@ -314,40 +538,900 @@ namespace RD_ADT
 	//
 	//    History Log:
 	//                      5/19/2016 RD completed version
+	//                      10/17/2026 RD returns a reference, keeps element order
+	//                      10/17/2026 RD reuses the cells already held
+	//-----------------------------------------------------------------------------
+
+	template <class T, class Alloc, class Stats>
+	list<T, Alloc, Stats>& list<T, Alloc, Stats>::operator=(const list<T, Alloc, Stats> & rlist)
+	{
+		if (&rlist != this)
+		{
+			size_t common = m_size < rlist.m_size ? m_size : rlist.m_size;
+			listelem* to = head;
+			const listelem* from = rlist.head;
+			for (size_t i = 0; i < common; i++)
+			{
+				to->data = from->data;
+				to = to->next;
+				from = from->next;
+			}
+			if (m_size > common)
+			{
+				size_t extra = m_size - common;
+				unlink_chain(to, tail, extra);
+				free_chain(to, extra);
+			}
+			else
+				append_chain(rlist.m_size - common,
+					[&from]() -> const T& { const T& datum = from->data; from = from->next; return datum; });
+			m_finger = nullptr;
+			if (!rlist.empty())
+				Stats::on_copy(m_size);
+		}
+		return *this;
+	}
+
+	//-----------------------------------------------------------------------------
+	//    Class:			list<T>
+	//	  Method:			list<T>::operator=(list && rlist)
+	//
+	//	  Description:		takes over the cells of rlist, leaving it empty;
+	//						moves element by element if the allocators differ
+	// 
+	//    Calls:            release(), swap(), push_back(), pop_front()
+	//    Called By:		n/a
+	// 
+	//    Parameters:		list && rlist
+	//	  Return:			*this
+	//
+	//    History Log:
+	//                      10/17/2026 RD completed version
 	//-----------------------------------------------------------------------------
 
-	template <class T>
-	list<T> list<T>::operator=(const list<T> & rlist)
+	template <class T, class Alloc, class Stats>
+	list<T, Alloc, Stats>& list<T, Alloc, Stats>::operator=(list<T, Alloc, Stats> && rlist)
 	{
 		if (&rlist != this)
 		{
-			list<T>::iterator r_it = rlist.begin();
 			release();
-			while (r_it != rlist.end())
-				push_back(*r_it++);
-			push_front(*r_it++);
+			if (m_alloc == rlist.m_alloc)
+				swap(rlist);
+			else
+			{
+				while (!rlist.empty())
+					push_back(rlist.pop_front());
+			}
 		}
 		return *this;
 	}
 
 	//-----------------------------------------------------------------------------
 	//    Class:			list<T>
-	//	  Method:			list<T>::iterator::operator++()
+	//	  Method:			list<T>::swap(list & x)
+	//
+	//	  Description:		exchanges the contents of two lists in O(1); if
+	//						the allocators differ the elements are moved
+	//						through a temporary list instead
+	// 
+	//    Calls:            list(list&&), operator=(list&&)
+	//    Called By:		operator=(list&&)
+	// 
+	//    Parameters:		list & x
+	//
+	//    History Log:
+	//                      10/17/2026 RD completed version
+	//                      10/17/2026 RD unequal allocators
+	//-----------------------------------------------------------------------------
+
+	template <class T, class Alloc, class Stats>
+	void list<T, Alloc, Stats>::swap(list<T, Alloc, Stats> & x)
+	{
+		if (&x == this)
+			return;
+		if (!(m_alloc == x.m_alloc))
+		{
+			list<T, Alloc, Stats> temp(std::move(x));
+			x = std::move(*this);
+			*this = std::move(temp);
+			return;
+		}
+		std::swap(head, x.head);
+		std::swap(tail, x.tail);
+		std::swap(m_size, x.m_size);
+		std::swap(m_finger, x.m_finger);
+		std::swap(m_fingerPos, x.m_fingerPos);
+	}
+
+	//-----------------------------------------------------------------------------
+	//    Class:			list<T>
+	//	  Method:			list<T>::link_back(list & x)
 	//
-	//	  Description:		pre-increment
+	//	  Description:		moves every cell of x onto the back of this list
+	//						with a constant number of pointer updates, leaving
+	//						x empty; moves element by element if the
+	//						allocators differ. The cells count as pushed
+	//						onto the back of this list and popped off the
+	//						front of x
+	// 
+	//    Calls:            push_back(), pop_front(), unlink_chain(), link_chain()
+	//    Called By:		append(), CQueue::push_bulk()
+	// 
+	//    Parameters:		list & x
+	//
+	//    History Log:
+	//                      10/17/2026 RD completed version
+	//                      10/17/2026 RD reports the batch to the Stats hooks
+	//-----------------------------------------------------------------------------
+
+	template <class T, class Alloc, class Stats>
+	void list<T, Alloc, Stats>::link_back(list<T, Alloc, Stats> & x)
+	{
+		if (&x == this || x.empty())
+			return;
+		if (!(m_alloc == x.m_alloc))
+		{
+			while (!x.empty())
+				push_back(x.pop_front());
+			return;
+		}
+
+		listelem* first = x.head;
+		listelem* last = x.tail;
+		size_t n = x.m_size;
+		x.unlink_chain(first, last, n);
+		int fingerPos = m_fingerPos;
+		listelem* finger = m_finger;
+		link_chain(nullptr, first, last, n);
+		m_finger = finger; // positions in front of the new cells are unchanged
+		m_fingerPos = fingerPos;
+		x.on_pop_front(n);
+		Stats::on_push_back(n);
+	}
+
+	//-----------------------------------------------------------------------------
+	//    Class:			list<T>
+	//	  Method:			list<T>::unlink_front(size_t n)
+	//
+	//	  Description:		detaches the first n cells (all of them if n is
+	//						larger than the list) as a new list. Finding the
+	//						cut costs n steps; the cut itself is a constant
+	//						number of pointer updates. If the new list cannot
+	//						share this list's allocator the first n elements
+	//						are moved into it instead. The cells count as
+	//						popped off the front of this list and pushed
+	//						onto the back of the new one.
+	// 
+	//    Calls:            swap(), unlink_chain(), link_chain(), push_back(),
+	//						pop_front()
+	//    Called By:		CQueue::pop_bulk()
+	// 
+	//    Parameters:		size_t n
+	//	  Return:			list holding the detached cells
+	//
+	//    History Log:
+	//                      10/17/2026 RD completed version
+	//                      10/17/2026 RD unequal allocators
+	//                      10/17/2026 RD reports the batch to the Stats hooks
+	//-----------------------------------------------------------------------------
+
+	template <class T, class Alloc, class Stats>
+	list<T, Alloc, Stats> list<T, Alloc, Stats>::unlink_front(size_t n)
+	{
+		list<T, Alloc, Stats> result;
+		if (n == 0 || empty())
+			return result;
+		result.m_alloc = m_alloc;
+		if (!(result.m_alloc == m_alloc))
+		{
+			for (; n > 0 && !empty(); n--)
+				result.push_back(pop_front());
+			return result;
+		}
+		if (n >= m_size)
+		{
+			result.swap(*this);
+			result.m_finger = nullptr;
+			Stats::on_pop_front(result.m_size);
+			result.on_push_back(result.m_size);
+			return result;
+		}
+
+		listelem* first = head;
+		listelem* last = head; // last cell to detach
+		for (size_t i = 1; i < n; i++)
+			last = last->next;
+
+		listelem* finger = m_fingerPos >= static_cast<int>(n) ? m_finger : nullptr;
+		int fingerPos = m_fingerPos - static_cast<int>(n);
+		unlink_chain(first, last, n);
+		m_finger = finger;
+		m_fingerPos = fingerPos;
+
+		result.link_chain(nullptr, first, last, n);
+		Stats::on_pop_front(n);
+		result.on_push_back(n);
+		return result;
+	}
+
+	//-----------------------------------------------------------------------------
+	//    Class:			list<T>
+	//	  Method:			list<T>::link_chain(listelem* pos, listelem* first,
+	//											listelem* last, size_t n)
+	//
+	//	  Description:		links the n cells first..last, already chained by
+	//						next/prev, in front of pos; pos == nullptr means
+	//						after the tail
+	// 
+	//    Calls:            none
+	//    Called By:		splice(), split_at(), link_back(), unlink_front()
+	// 
+	//    Parameters:		listelem* pos, listelem* first, listelem* last, size_t n
+	//
+	//    History Log:
+	//                      10/17/2026 RD completed version
+	//-----------------------------------------------------------------------------
+
+	template <class T, class Alloc, class Stats>
+	void list<T, Alloc, Stats>::link_chain(listelem* pos, listelem* first, listelem* last, size_t n)
+	{
+		if (empty())
+		{
+			head = first;
+			tail = last;
+		}
+		else
+		{
+			listelem* before = pos != nullptr ? pos->prev : tail;
+			first->prev = before;
+			last->next = pos;
+			if (before != nullptr)
+				before->next = first;
+			else
+				head = first;
+			if (pos != nullptr)
+				pos->prev = last;
+			else
+				tail = last;
+		}
+		m_size += static_cast<unsigned>(n);
+		m_finger = nullptr;
+		Stats::on_size(m_size);
+	}
+
+	//-----------------------------------------------------------------------------
+	//    Class:			list<T>
+	//	  Method:			list<T>::unlink_chain(listelem* first, listelem* last, size_t n)
+	//
+	//	  Description:		removes the n cells first..last from the list
+	//						without freeing them; they stay chained to each
+	//						other, with null links at both ends
+	// 
+	//    Calls:            none
+	//    Called By:		splice(), split_at(), link_back(), unlink_front()
+	// 
+	//    Parameters:		listelem* first, listelem* last, size_t n
+	//
+	//    History Log:
+	//                      10/17/2026 RD completed version
+	//-----------------------------------------------------------------------------
+
+	template <class T, class Alloc, class Stats>
+	void list<T, Alloc, Stats>::unlink_chain(listelem* first, listelem* last, size_t n)
+	{
+		if (n == m_size)
+			head = tail = nullptr;
+		else
+		{
+			listelem* before = first->prev;
+			listelem* after = last->next;
+			if (before != nullptr)
+				before->next = after;
+			else
+				head = after;
+			if (after != nullptr)
+				after->prev = before;
+			else
+				tail = before;
+		}
+		first->prev = nullptr;
+		last->next = nullptr;
+		m_size -= static_cast<unsigned>(n);
+		m_finger = nullptr;
+	}
+
+	//-----------------------------------------------------------------------------
+	//    Class:			list<T>
+	//	  Method:			list<T>::splice(const_iterator pos, list & x)
+	//
+	//	  Description:		moves every cell of x in front of pos in O(1);
+	//						pos == end() means after the tail. If the
+	//						allocators differ the elements are moved into new
+	//						cells instead, in O(n).
+	// 
+	//    Calls:            unlink_chain(), link_chain(), create_node(),
+	//						pop_front()
+	//    Called By:		n/a
+	// 
+	//    Parameters:		const_iterator pos, list & x
+	//
+	//    History Log:
+	//                      10/17/2026 RD completed version
+	//                      10/17/2026 RD unequal allocators
+	//-----------------------------------------------------------------------------
+
+	template <class T, class Alloc, class Stats>
+	void list<T, Alloc, Stats>::splice(const_iterator pos, list<T, Alloc, Stats> & x)
+	{
+		if (&x == this || x.empty())
+			return;
+		if (!(m_alloc == x.m_alloc))
+		{
+			while (!x.empty())
+			{
+				listelem* e = create_node(nullptr, nullptr, std::move(x.head->data));
+				link_chain(pos.node(), e, e, 1);
+				x.pop_front();
+			}
+			return;
+		}
+		listelem* first = x.head;
+		listelem* last = x.tail;
+		size_t n = x.m_size;
+		x.unlink_chain(first, last, n);
+		link_chain(pos.node(), first, last, n);
+	}
+
+	//-----------------------------------------------------------------------------
+	//    Class:			list<T>
+	//	  Method:			list<T>::splice(const_iterator pos, list & x, const_iterator it)
+	//
+	//	  Description:		moves the single cell it of x in front of pos in
+	//						O(1); x may be this list. If the allocators
+	//						differ the element is moved into a new cell
+	// 
+	//    Calls:            unlink_chain(), link_chain(), create_node(), erase()
+	//    Called By:		linked_hash_map::move_to_front(), move_to_back()
+	// 
+	//    Parameters:		const_iterator pos, list & x, const_iterator it
+	//
+	//    History Log:
+	//                      10/17/2026 RD completed version
+	//                      10/17/2026 RD unequal allocators
+	//-----------------------------------------------------------------------------
+
+	template <class T, class Alloc, class Stats>
+	void list<T, Alloc, Stats>::splice(const_iterator pos, list<T, Alloc, Stats> & x, const_iterator it)
+	{
+		listelem* e = it.node();
+		if (e == nullptr)
+			throw runtime_error("nullptr pointer");
+		if (e == pos.node())
+			return;
+		if (&x != this && !(m_alloc == x.m_alloc))
+		{
+			listelem* moved = create_node(nullptr, nullptr, std::move(e->data));
+			link_chain(pos.node(), moved, moved, 1);
+			x.erase(it);
+			return;
+		}
+		x.unlink_chain(e, e, 1);
+		link_chain(pos.node(), e, e, 1);
+	}
+
+	//-----------------------------------------------------------------------------
+	//    Class:			list<T>
+	//	  Method:			list<T>::split_at(const_iterator it)
+	//
+	//	  Description:		cuts the list in front of it; this list keeps the
+	//						cells before it and the cells from it to the tail
+	//						are returned. The new sizes are found by walking
+	//						out from it in both directions at once, so the
+	//						cost is the length of the shorter part. If the
+	//						new list cannot share this list's allocator the
+	//						elements from it on are moved into it instead.
+	// 
+	//    Calls:            unlink_chain(), link_chain(), erase()
+	//    Called By:		parallel_sort()
+	// 
+	//    Parameters:		const_iterator it
+	//	  Return:			list holding it through the old tail
+	//
+	//    History Log:
+	//                      10/17/2026 RD completed version
+	//                      10/17/2026 RD unequal allocators
+	//-----------------------------------------------------------------------------
+
+	template <class T, class Alloc, class Stats>
+	list<T, Alloc, Stats> list<T, Alloc, Stats>::split_at(const_iterator it)
+	{
+		list<T, Alloc, Stats> result;
+		result.m_alloc = m_alloc;
+		listelem* first = it.node();
+		if (first == nullptr)
+			return result;
+		if (!(result.m_alloc == m_alloc))
+		{
+			while (it != end())
+			{
+				result.push_back(std::move(first->data));
+				it = erase(it);
+				first = it.node();
+			}
+			return result;
+		}
+
+		// walk forward to the tail and backward to the head together
+		size_t n = 0;
+		listelem* fwd = first;
+		listelem* bwd = first;
+		for (;;)
+		{
+			if (fwd == tail)
+			{
+				n = n + 1;
+				break;
+			}
+			if (bwd == head)
+			{
+				n = m_size - n;
+				break;
+			}
+			fwd = fwd->next;
+			bwd = bwd->prev;
+			n++;
+		}
+
+		listelem* last = tail;
+		unlink_chain(first, last, n);
+		result.link_chain(nullptr, first, last, n);
+		return result;
+	}
+
+	//-----------------------------------------------------------------------------
+	//    Class:			list<T>
+	//	  Method:			list<T>::rotate(const_iterator it)
+	//
+	//	  Description:		makes it the head in O(1) by joining the old tail
+	//						to the old head and cutting the chain in front
+	//						of it
+	// 
+	//    Calls:            none
+	//    Called By:		n/a
+	// 
+	//    Parameters:		const_iterator it
+	//
+	//    History Log:
+	//                      10/17/2026 RD completed version
+	//-----------------------------------------------------------------------------
+
+	template <class T, class Alloc, class Stats>
+	void list<T, Alloc, Stats>::rotate(const_iterator it)
+	{
+		listelem* e = it.node();
+		if (e == nullptr || e == head)
+			return;
+		tail->next = head;
+		head->prev = tail;
+		head = e;
+		tail = e->prev;
+		head->prev = nullptr;
+		tail->next = nullptr;
+		m_finger = nullptr;
+	}
+
+	//-----------------------------------------------------------------------------
+	//    Class:			list<T>
+	//	  Method:			list<T>::erase(const_iterator it)
+	//
+	//	  Description:		unlinks the cell it and destroys it in O(1);
+	//						other iterators stay valid
+	//	  Return:			iterator to the cell after it, or end()
+	// 
+	//    Calls:            unlink_chain(), destroy_node()
+	//    Called By:		linked_hash_map
+	// 
+	//    Parameters:		const_iterator it
+	//
+	//    History Log:
+	//                      10/17/2026 RD completed version
+	//-----------------------------------------------------------------------------
+
+	template <class T, class Alloc, class Stats>
+	typename list<T, Alloc, Stats>::iterator list<T, Alloc, Stats>::erase(const_iterator it)
+	{
+		listelem* e = it.node();
+		if (e == nullptr)
+			throw runtime_error("nullptr pointer");
+		listelem* next = e->next;
+		unlink_chain(e, e, 1);
+		destroy_node(e);
+		return iterator(next, this);
+	}
+
+	//-----------------------------------------------------------------------------
+	//    Class:			list<T>
+	//	  Method:			list<T>::sort(Compare comp)
+	//
+	//	  Description:		stable bottom-up merge sort. The cells are fed
+	//						one at a time, along next, into a binary counter of sorted runs: bin i
+	//						holds a run of 2^i cells or nothing, and a new
+	//						cell carries up through the full bins, merging
+	//						with each, like adding one. The bins are merged
+	//						together at the end. Runs are merged while their
+	//						cells are still in cache, and only next links are
+	//						touched; the prev links are rebuilt once at the
+	//						end. No cell is allocated, and the
+	//						bins are a fixed array, so extra space is O(1). If
+	//						comp throws, every cell is linked back in some
+	//						order.
+	// 
+	//    Calls:            merge_chains(), relink()
+	//    Called By:		parallel_sort()
+	// 
+	//    Parameters:		Compare comp -- strict weak ordering
+	//
+	//    History Log:
+	//                      10/17/2026 RD completed version
+	//-----------------------------------------------------------------------------
+
+	template <class T, class Alloc, class Stats>
+	template <class Compare>
+	void list<T, Alloc, Stats>::sort(Compare comp)
+	{
+		if (m_size < 2)
+			return;
+		const size_t bits = sizeof(size_t) * 8;
+		listelem* bin[bits] = {}; // bin[i] is a sorted run of 2^i cells or nullptr
+		size_t fill = 0; // bins in use
+		listelem* run = nullptr; // the run being carried
+		listelem* rest = head; // cells not fed in yet
+		try
+		{
+			while (rest != nullptr)
+			{
+				run = rest;
+				rest = rest->next;
+				run->next = nullptr;
+				size_t i = 0;
+				for (; i < fill && bin[i] != nullptr; i++)
+				{
+					listelem* older = bin[i];
+					bin[i] = nullptr;
+					merge_chains(run, older, run, comp);
+				}
+				bin[i] = run;
+				run = nullptr;
+				if (i == fill)
+					fill++;
+			}
+			// the lower bins hold the later cells
+			for (size_t i = 0; i < fill; i++)
+			{
+				if (bin[i] == nullptr)
+					continue;
+				listelem* older = bin[i];
+				bin[i] = nullptr;
+				merge_chains(run, older, run, comp);
+			}
+		}
+		catch (...)
+		{
+			// the carried run, the bins, then the cells not fed in
+			for (size_t i = 0; i < fill; i++)
+				run = concat(run, bin[i]);
+			relink(concat(run, rest));
+			throw;
+		}
+		relink(run);
+	}
+
+	//-----------------------------------------------------------------------------
+	//    Class:			list<T>
+	//	  Method:			list<T>::merge(list&& x, Compare comp)
+	//
+	//	  Description:		merges the cells of x, sorted by comp, into this
+	//						list, sorted by comp, by relinking; equal
+	//						elements of this list stay in front of those of
+	//						x. x is left empty. If the allocators differ the
+	//						elements of x are first moved into new cells at
+	//						the back, then the two runs are merged.
+	// 
+	//    Calls:            merge_chains(), relink(), link_back()
+	//    Called By:		parallel_sort()
+	// 
+	//    Parameters:		list&& x, Compare comp -- strict weak ordering
+	//
+	//    History Log:
+	//                      10/17/2026 RD completed version
+	//                      10/17/2026 RD unequal allocators
+	//-----------------------------------------------------------------------------
+
+	template <class T, class Alloc, class Stats>
+	template <class Compare>
+	void list<T, Alloc, Stats>::merge(list<T, Alloc, Stats> && x, Compare comp)
+	{
+		if (&x == this || x.empty())
+			return;
+		listelem* a = empty() ? nullptr : head;
+		listelem* b;
+		if (m_alloc == x.m_alloc)
+		{
+			b = x.head;
+			m_size += x.m_size;
+			x.head = x.tail = nullptr;
+			x.m_size = 0;
+			x.m_finger = nullptr;
+		}
+		else
+		{
+			size_t n = m_size;
+			link_back(x);
+			if (a == nullptr)
+				return;
+			b = head;
+			for (size_t i = 0; i < n; i++)
+				b = b->next;
+			b->prev->next = nullptr;
+		}
+
+		listelem* first = nullptr;
+		try { merge_chains(first, a, b, comp); }
+		catch (...) { relink(first); throw; }
+		relink(first);
+		Stats::on_size(m_size);
+	}
+
+	//-----------------------------------------------------------------------------
+	//    Class:			list<T>
+	//	  Method:			list<T>::merge_chains(listelem*& first, listelem* a,
+	//											  listelem* b, Compare& comp)
+	//
+	//	  Description:		merges the null-terminated next chains a and b,
+	//						taking from a on ties, into the chain at first.
+	//						If comp throws, first still leads to every cell
+	//						of a and b, the unmerged ones appended in order
+	// 
+	//    Calls:            concat()
+	//    Called By:		sort(), merge()
+	// 
+	//    Parameters:		listelem*& first -- the result, may be a or b,
+	//						listelem* a, listelem* b, Compare& comp
+	//
+	//    History Log:
+	//                      10/17/2026 RD completed version
+	//-----------------------------------------------------------------------------
+
+	template <class T, class Alloc, class Stats>
+	template <class Compare>
+	void list<T, Alloc, Stats>::merge_chains(listelem*& first, listelem* a, listelem* b, Compare& comp)
+	{
+		listelem* out = nullptr;
+		listelem** link = &out; // where the next cell is hooked on
+		try
+		{
+			while (a != nullptr && b != nullptr)
+			{
+				if (comp(b->data, a->data))
+				{
+					*link = b;
+					b = b->next;
+				}
+				else
+				{
+					*link = a;
+					a = a->next;
+				}
+				link = &(*link)->next;
+			}
+		}
+		catch (...)
+		{
+			*link = a;
+			first = concat(out, b);
+			throw;
+		}
+		*link = a != nullptr ? a : b; // already in order
+		first = out;
+	}
+
+	//-----------------------------------------------------------------------------
+	//    Class:			list<T>
+	//	  Method:			list<T>::concat(listelem* a, listelem* b)
+	//
+	//	  Description:		hooks the null-terminated next chain b onto the
+	//						end of a
+	//	  Return:			the joined chain
+	// 
+	//    Calls:            none
+	//    Called By:		sort(), merge_chains()
+	// 
+	//    Parameters:		listelem* a, listelem* b -- either may be nullptr
+	//
+	//    History Log:
+	//                      10/17/2026 RD completed version
+	//-----------------------------------------------------------------------------
+
+	template <class T, class Alloc, class Stats>
+	typename list<T, Alloc, Stats>::listelem* list<T, Alloc, Stats>::concat(listelem* a, listelem* b)
+	{
+		if (a == nullptr)
+			return b;
+		listelem* last = a;
+		while (last->next != nullptr)
+			last = last->next;
+		last->next = b;
+		return a;
+	}
+
+	//-----------------------------------------------------------------------------
+	//    Class:			list<T>
+	//	  Method:			list<T>::relink(listelem* first)
+	//
+	//	  Description:		makes the null-terminated next chain at first,
+	//						holding every cell of the list, the list again:
+	//						prev links are rebuilt along next, then head
+	//						and tail
+	// 
+	//    Calls:            none
+	//    Called By:		sort(), merge()
+	// 
+	//    Parameters:		listelem* first
+	//
+	//    History Log:
+	//                      10/17/2026 RD completed version
+	//-----------------------------------------------------------------------------
+
+	template <class T, class Alloc, class Stats>
+	void list<T, Alloc, Stats>::relink(listelem* first)
+	{
+		listelem* last = first;
+		for (; last->next != nullptr; last = last->next)
+			last->next->prev = last;
+		head = first;
+		tail = last;
+		head->prev = nullptr;
+		m_finger = nullptr;
+	}
+
+	//-----------------------------------------------------------------------------
+	//    Class:			list<T>
+	//	  Method:			list<T>::append_chain(size_t n, Source next)
+	//
+	//	  Description:		builds n cells, the data of each copied from
+	//						next(), chains them and links the chain onto the
+	//						back with one link_chain. If building a cell
+	//						throws, the cells built so far are freed and the
+	//						list is unchanged
+	// 
+	//    Calls:            create_node(), free_chain(), link_chain()
+	//    Called By:		list(size_t, const T&), list(const list&),
+	//						list(InputIt, InputIt), operator=()
+	// 
+	//    Parameters:		size_t n, Source next -- returns the next datum
+	//
+	//    History Log:
+	//                      10/17/2026 RD completed version
+	//-----------------------------------------------------------------------------
+
+	template <class T, class Alloc, class Stats>
+	template <class Source>
+	void list<T, Alloc, Stats>::append_chain(size_t n, Source next)
+	{
+		if (n == 0)
+			return;
+		listelem* first = create_node(nullptr, nullptr, next());
+		listelem* last = first;
+		size_t built = 1;
+		try
+		{
+			for (; built < n; built++)
+			{
+				listelem* e = create_node(last, nullptr, next());
+				last->next = e;
+				last = e;
+			}
+		}
+		catch (...)
+		{
+			free_chain(first, built);
+			throw;
+		}
+		int fingerPos = m_fingerPos;
+		listelem* finger = m_finger;
+		link_chain(nullptr, first, last, n);
+		m_finger = finger; // positions in front of the new cells are unchanged
+		m_fingerPos = fingerPos;
+	}
+
+	//-----------------------------------------------------------------------------
+	//    Class:			list<T>
+	//	  Method:			list<T>::free_chain(listelem* first, size_t n)
+	//
+	//	  Description:		destroys and frees n cells following next links
+	//						from first; the cells must already be out of
+	//						the list. Trivially destructible data is not
+	//						destroyed one by one, the cells are just freed
+	// 
+	//    Calls:            destroy_node(), node_traits::deallocate()
+	//    Called By:		release(), operator=(), append_chain()
+	// 
+	//    Parameters:		listelem* first, size_t n
+	//
+	//    History Log:
+	//                      10/17/2026 RD completed version
+	//-----------------------------------------------------------------------------
+
+	template <class T, class Alloc, class Stats>
+	void list<T, Alloc, Stats>::free_chain(listelem* first, size_t n)
+	{
+		for (; n > 0; n--)
+		{
+			listelem* next = first->next;
+			if constexpr (is_trivially_destructible<T>::value)
+			{
+				node_traits::deallocate(m_alloc, first, 1);
+				Stats::on_free();
+			}
+			else
+				destroy_node(first);
+			first = next;
+		}
+	}
+
+	//-----------------------------------------------------------------------------
+	//    Class:			list<T>
+	//	  Method:			list<T>::release()
+	//
+	//	  Description:		removes every element; the chain is detached
+	//						first, then its cells are freed in one pass
+	// 
+	//    Calls:            free_chain()
+	//    Called By:		~list(), main
+	// 
+	//    Parameters:		none
+	//
+	//    History Log:
+	//                      5/19/2016 RD completed version
+	//                      10/17/2026 RD one pass over the cells instead of pop_front per element
+	//-----------------------------------------------------------------------------
+
+	template <class T, class Alloc, class Stats>
+	void list<T, Alloc, Stats>::release()
+	{
+		if (head == nullptr)
+			return;
+		listelem* first = head;
+		size_t n = m_size;
+		head = tail = m_finger = nullptr;
+		m_size = 0;
+		m_fingerPos = 0;
+		free_chain(first, n);
+	}
+
+	//-----------------------------------------------------------------------------
+	//    Class:			list<T>
+	//	  Method:			list<T>::basic_iterator<Const>::operator++()
+	//
+	//	  Description:		pre-increment, steps from the tail to end()
+	//						through the tail's null next link, so the walk
+	//						ends on whichever list the cell is in now
 	//	  Return:			*this
 	// 
 	//    Calls:            none
-	//    Called By:		main, push_front()
+	//    Called By:		main, operator++(int)
 	// 
 	//    Parameters:		None
 	//
 	//    History Log:
 	//                      5/19/2016 RD completed version
+	//                      10/17/2026 RD stops at end() instead of wrapping to the head
+	//                      10/17/2026 RD follows the cell's link, not the owner's tail
 	//-----------------------------------------------------------------------------
 
-	template <class T>
-	typename list<T>::iterator list<T>::iterator::operator++()
+	template <class T, class Alloc, class Stats>
+	template <bool Const>
+	typename list<T, Alloc, Stats>::template basic_iterator<Const>& list<T, Alloc, Stats>::basic_iterator<Const>::operator++()
 	{
 		if (ptr == nullptr)
 			throw runtime_error("nullptr pointer");
@@ -357,13 +1441,13 @@ namespace RD_ADT
 
 	//-----------------------------------------------------------------------------
 	//    Class:			list<T>
-	//	  Method:			list<T>::iterator::operator++(int)
+	//	  Method:			list<T>::basic_iterator<Const>::operator++(int)
 	//
 	//	  Description:		post-increment
 	//	  Return:			temp
 	// 
-	//    Calls:            none
-	//    Called By:		main, push_back
+	//    Calls:            operator++()
+	//    Called By:		main
 	// 
 	//    Parameters:		int
 	//
@@ -371,51 +1455,57 @@ namespace RD_ADT
 	//                      5/19/2016 RD completed version
 	//-----------------------------------------------------------------------------
 
-	template <class T>
-	typename list<T>::iterator list<T>::iterator::operator++(int)
+	template <class T, class Alloc, class Stats>
+	template <bool Const>
+	typename list<T, Alloc, Stats>::template basic_iterator<Const> list<T, Alloc, Stats>::basic_iterator<Const>::operator++(int)
 	{
-		if (ptr == nullptr)
-			throw runtime_error("nullptr pointer");
-		iterator temp = *this;
-		ptr = ptr->next;
+		basic_iterator temp = *this;
+		++*this;
 		return temp;
 	}
 
 
 	//-----------------------------------------------------------------------------
 	//    Class:			list<T>
-	//	  Method:			list<T>::iterator::operator--()
+	//	  Method:			list<T>::basic_iterator<Const>::operator--()
 	//
-	//	  Description:		pre-decrement
+	//	  Description:		pre-decrement, steps from end() to the tail
 	//	  Return:			*this
 	// 
 	//    Calls:            none
-	//    Called By:		n/a
+	//    Called By:		operator--(int), reverse_iterator
 	// 
 	//    Parameters:		none
 	//
 	//    History Log:
 	//                      5/19/2016 RD completed version
+	//                      10/17/2026 RD end() steps back to the tail
 	//-----------------------------------------------------------------------------
 
-	template <class T>
-	typename list<T>::iterator list<T>::iterator::operator--()
+	template <class T, class Alloc, class Stats>
+	template <bool Const>
+	typename list<T, Alloc, Stats>::template basic_iterator<Const>& list<T, Alloc, Stats>::basic_iterator<Const>::operator--()
 	{
 		if (ptr == nullptr)
-			throw runtime_error("nullptr pointer");
-		ptr = ptr->prev;
+		{
+			if (owner == nullptr || owner->tail == nullptr)
+				throw runtime_error("nullptr pointer");
+			ptr = owner->tail;
+		}
+		else
+			ptr = ptr->prev;
 		return *this;
 	}
 
 	//-----------------------------------------------------------------------------
 	//    Class:			list<T>
-	//	  Method:			list<T>::iterator::operator--(int)
+	//	  Method:			list<T>::basic_iterator<Const>::operator--(int)
 	//
 	//	  Description:		post-decrement
 	//	  Return:			temp
 	// 
-	//    Calls:            none
-	//    Called By:		pop_front(), pop_back()
+	//    Calls:            operator--()
+	//    Called By:		n/a
 	// 
 	//    Parameters:		int
 	//
@@ -423,13 +1513,12 @@ namespace RD_ADT
 	//                      5/19/2016 RD completed version
 	//-----------------------------------------------------------------------------
 
-	template <class T>
-	typename list<T>::iterator list<T>::iterator::operator--(int)
+	template <class T, class Alloc, class Stats>
+	template <bool Const>
+	typename list<T, Alloc, Stats>::template basic_iterator<Const> list<T, Alloc, Stats>::basic_iterator<Const>::operator--(int)
 	{
-		if (ptr == nullptr)
-			throw runtime_error("nullptr pointer");
-		iterator temp = *this;
-		ptr = ptr->prev;
+		basic_iterator temp = *this;
+		--*this;
 		return temp;
 	}
 
@@ -438,82 +1527,78 @@ namespace RD_ADT
 	//	  Method:			list<T>::pop_front()
 	//
 	//	  Description:		removes front element and returns the data from that element
-	//	  Return:			*temp if m_size == 1
-	//						data
+	//	  Return:			data, moved out of the cell
 	// 
-	//    Calls:            none
+	//    Calls:            destroy_node()
 	//    Called By:		n/a
 	// 
 	//    Parameters:		none
 	//
 	//    History Log:
 	//                      5/19/2016 RD completed version
+	//                      10/17/2026 RD moves the data out
 	//-----------------------------------------------------------------------------
 
-	template <class T>
-	T list<T>::pop_front()
+	template <class T, class Alloc, class Stats>
+	T list<T, Alloc, Stats>::pop_front()
 	{
 		if (head == nullptr)
 			throw runtime_error("Empty list");
+
+		T data(std::move(head->data));
+		listelem* temp = head;
+		if (m_finger == head)
+			m_finger = nullptr;
+		m_fingerPos--;
 		if (m_size == 1)
-		{
-			m_size--;
-			T temp = head->data;
-			delete head;
 			head = tail = nullptr;
-			return temp;
-		}
-
-		T data = head->data;
-		iterator temp = begin();
-		temp++;
-		delete head;
-		head = temp;
-		if (!empty())
-			head->prev = tail;
 		else
-			tail = nullptr;
-
+		{
+			head = head->next;
+			head->prev = nullptr;
+		}
+		destroy_node(temp);
 		m_size--;
-			return data;
+		Stats::on_pop_front();
+		return data;
 	}
 
 	//-----------------------------------------------------------------------------
 	//    Class:			list<T>
-	//	  Method:			list<T>::push_back(T datum)
+	//	  Method:			list<T>::emplace_back(Args&&... args)
 	//
-	//	  Description:		insert element at last of list
+	//	  Description:		insert element at last of list, built in place
+	//						from args; push_back(const T&) and push_back(T&&)
+	//						forward here
 	//	  Return:			none
 	// 
-	//    Calls:            none
+	//    Calls:            create_node()
 	//    Called By:		n/a
 	// 
-	//    Parameters:		T datum
+	//    Parameters:		Args&&... args
 	//
 	//    History Log:
 	//                      5/19/2016 RD completed version
+	//                      10/17/2026 RD builds the datum in place
 	//-----------------------------------------------------------------------------
 
-	template<class T>
-	void list<T>::push_back(T datum)
+	template <class T, class Alloc, class Stats>
+	template <class... Args>
+	void list<T, Alloc, Stats>::emplace_back(Args&&... args)
 	{
-		listelem* temp = new listelem(datum, tail, head);
+		listelem* temp = create_node(tail, nullptr, std::forward<Args>(args)...);
 
 		if (!empty())
 		{
 			tail->next = temp;
 			tail = temp;
-			head->prev = tail;
 		}
 		else
-		{
 			head = tail = temp;
-			temp->next = tail;
-			temp->prev = head;
-		}
 
 		m_size++;
-
+		Stats::on_push_back();
+		Stats::on_size(m_size);
 	}
 
 	//-----------------------------------------------------------------------------
@@ -521,145 +1606,145 @@ namespace RD_ADT
 	//	  Method:			list<T>::pop_back()
 	//
 	//	  Description:		remove last element of list
-	//	  Return:			none
+	//	  Return:			data, moved out of the cell
 	// 
-	//    Calls:            none
+	//    Calls:            destroy_node()
 	//    Called By:		n/a
 	// 
-	//    Parameters:		T datum
+	//    Parameters:		none
 	//
 	//    History Log:
 	//                      5/19/2016 RD completed version
+	//                      10/17/2026 RD moves the data out
 	//-----------------------------------------------------------------------------
 
-	template <class T>
-	T list<T>::pop_back()
+	template <class T, class Alloc, class Stats>
+	T list<T, Alloc, Stats>::pop_back()
 	{
 		if (tail == nullptr)
 			throw runtime_error("Empty list");
 
+		T data(std::move(tail->data));
+		listelem* temp = tail;
+		if (m_finger == tail)
+			m_finger = nullptr;
 		if (m_size == 1)
-		{
-			m_size--;
-			T temp = tail->data;
-			delete tail;
 			head = tail = nullptr;
-			return temp;
+		else
+		{
+			tail = tail->prev;
+			tail->next = nullptr;
 		}
-
+		destroy_node(temp);
 		m_size--;
-		T data = tail->data;
-		iterator temp = end();
-		temp--;
-		delete tail;
-		tail = temp;
-
-		if (empty())
-			head = nullptr;
-		else
-			tail->next = head;
-
+		Stats::on_pop_back();
 		return data;
 	}
 
 	//-----------------------------------------------------------------------------
 	//    Class:			list<T>
-	//	  Method:			list<T>::operator[](int index)
+	//	  Method:			list<T>::locate(int index, int& pos)const
 	//
-	//	  Description:		[] operator -- l-value
+	//	  Description:		finds the cell at index (negative counts from the
+	//						back) by walking from whichever of head, tail or
+	//						the cached finger is closest. The list is not
+	//						written, so concurrent const lookups are safe
+	//						with no_stats; moving the finger is left to the
+	//						caller.
 	// 
 	//    Calls:            getSize()
-	//    Called By:		main
+	//    Called By:		operator[]
 	// 
-	//    Parameters:		int index
-	//	  Return:			*it
+	//    Parameters:		int index, int& pos -- set to the positive position
+	//	  Return:			cell at index
 	//
 	//    History Log:
-	//                      5/19/2016 RD completed version
+	//                      10/17/2026 RD completed version
 	//-----------------------------------------------------------------------------
 
-	template <class T>
-	T& list<T>::operator[](int index)
+	template <class T, class Alloc, class Stats>
+	typename list<T, Alloc, Stats>::listelem* list<T, Alloc, Stats>::locate(int index, int& pos)const
 	{
-		iterator it;
-		if (index >= 0)
+		int size = static_cast<int>(getSize());
+		if (index >= size || index < -size)
+			throw out_of_range("index out-of-range");
+		pos = index >= 0 ? index : size + index; // make the range positive
+
+		listelem* p = head;
+		int dist = pos; // steps forward from head
+		if (size - 1 - pos < dist)
 		{
-			if (index >= static_cast<int>(getSize()))
-				throw out_of_range("index out-of-range");
-			it = begin();
-			for (int i = 0; i < index; i++)
-				it++;
+			p = tail;
+			dist = pos - (size - 1); // steps backward from tail, <= 0
 		}
-		else
+		if (m_finger != nullptr && abs(pos - m_fingerPos) < abs(dist))
 		{
-			if (index < -(static_cast<int>(getSize())))
-				throw out_of_range("index out-of-range");
-			it = end();
-			for (int i = -1; i > index; i--)
-				it--;
+			p = m_finger;
+			dist = pos - m_fingerPos;
 		}
-		return *it;
+
+		Stats::on_index(static_cast<size_t>(abs(dist)));
+		for (; dist > 0; dist--)
+			p = p->next;
+		for (; dist < 0; dist++)
+			p = p->prev;
+		return p;
 	}
 
 	//-----------------------------------------------------------------------------
 	//    Class:			list<T>
-	//	  Method:			list<T>::operator[](int index)const
+	//	  Method:			list<T>::operator[](int index)
 	//
-	//	  Description:		[] operator -- r-value
+	//	  Description:		[] operator -- l-value; moves the finger to the
+	//						cell found
 	// 
-	//    Calls:            getSize(), begin(), end()
+	//    Calls:            locate()
 	//    Called By:		main
 	// 
 	//    Parameters:		int index
-	//	  Return:			*it
+	//	  Return:			data at index
 	//
 	//    History Log:
 	//                      5/19/2016 RD completed version
+	//                      10/17/2026 RD walks from the nearest of head, tail and finger
+	//                      10/17/2026 RD moves the finger here rather than in locate()
 	//-----------------------------------------------------------------------------
 
-	template <class T>
-	const T& list<T>::operator[](int index)const
+	template <class T, class Alloc, class Stats>
+	T& list<T, Alloc, Stats>::operator[](int index)
 	{
-		int middle = m_size / 2;
-		iterator it;
-		if (index >= 0)
-		{
-			if (index >= static_cast<int>(getSize()))
-				throw out_of_range("index out-of-range");
-			if (index <= middle)
-			{
-				it = begin();
-				for (int i = 0; i < index; i++)
-					it++;
-			}
-			else
-			{
-				it = end();
-				for (int i = m_size; i > 0; i--)
-					it--;
-			}
+		int pos;
+		listelem* p = locate(index, pos);
+		m_finger = p;
+		m_fingerPos = pos;
+		return p->data;
+	}
 
-		}
-		else
-		{
-			if (index < -(static_cast<int>(getSize())))
-				throw out_of_range("index out-of-range");
-			int pos = m_size + index;// make the range positive
+	//-----------------------------------------------------------------------------
+	//    Class:			list<T>
+	//	  Method:			list<T>::operator[](int index)const
+	//
+	//	  Description:		[] operator -- r-value; uses the finger but
+	//						leaves it where it is, so const access from
+	//						several threads at once does not race
+	// 
+	//    Calls:            locate()
+	//    Called By:		main
+	// 
+	//    Parameters:		int index
+	//	  Return:			data at index
+	//
+	//    History Log:
+	//                      5/19/2016 RD completed version
+	//                      10/17/2026 RD walks from the nearest of head, tail and finger
+	//                      10/17/2026 RD no longer moves the finger
+	//-----------------------------------------------------------------------------
 
-			if (pos >= middle)
-			{
-				it = end();
-				for (int i = m_size; i > 0; i--)
-					it--;
-			}
-			else
-			{
-				it = begin();
-				for (int i = 0; i < pos; i++)
-					it++;
-			}
-		}
-		return *it;
+	template <class T, class Alloc, class Stats>
+	const T& list<T, Alloc, Stats>::operator[](int index)const
+	{
+		int pos;
+		return locate(index, pos)->data;
 	}
 }
 	 #endif 